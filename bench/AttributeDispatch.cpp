@@ -0,0 +1,192 @@
+/*
+ * Measures the cost of mapping XML attribute names to object properties, as done by Dungeon::loadObjects() for every
+ * attribute of every object.
+ *
+ * Usage: bench-attribute-dispatch [dungeon.xml]
+ *
+ * Without arguments, a synthetic dungeon with a representative attribute mix is generated in memory.
+ */
+
+#include <SFML/System/Clock.hpp>
+#include <Shared/External/PugiXML/pugixml.hpp>
+#include <Shared/Level/Object.hpp>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const std::size_t SYNTHETIC_LEVEL_COUNT = 16;
+const std::size_t SYNTHETIC_OBJECTS_PER_TYPE = 2000;
+const std::size_t REPEAT_COUNT = 20;
+
+/**
+ * Reference implementation: the linear strcmp() search used before the hash-based lookup.
+ */
+Object::Property getPropertyByNameLinear(const char * propName)
+{
+	for (std::size_t i = 0; i < std::size_t(Object::Property::Count); ++i)
+	{
+		Object::Property property = Object::Property(i);
+
+		if (std::strcmp(Object::getPropertyName(property), propName) == 0)
+		{
+			return property;
+		}
+	}
+	return Object::Property::Invalid;
+}
+
+void appendSyntheticObjects(pugi::xml_node levelNode, Object::Type type)
+{
+	pugi::xml_node listNode = levelNode.append_child(Object::getTypeNamePlural(type));
+
+	for (std::size_t i = 0; i < SYNTHETIC_OBJECTS_PER_TYPE; ++i)
+	{
+		pugi::xml_node node = listNode.append_child(Object::getTypeName(type));
+		node.append_attribute("x").set_value(int(i % 64));
+		node.append_attribute("y").set_value(int(i / 64));
+
+		switch (type)
+		{
+		case Object::Type::Trap:
+			node.append_attribute("type").set_value(int(i % 10));
+			node.append_attribute("subtype").set_value(int(i % 4));
+			break;
+		case Object::Type::Enemy:
+			node.append_attribute("type").set_value(int(i % 300));
+			node.append_attribute("beatDelay").set_value(0);
+			node.append_attribute("lord").set_value(0);
+			break;
+		case Object::Type::Item:
+			node.append_attribute("type").set_value("food_1");
+			node.append_attribute("bloodCost").set_value(0);
+			node.append_attribute("saleCost").set_value(0);
+			node.append_attribute("singleChoice").set_value(0);
+			break;
+		case Object::Type::Chest:
+			node.append_attribute("color").set_value(1);
+			node.append_attribute("contents").set_value("no_item");
+			node.append_attribute("hidden").set_value(0);
+			node.append_attribute("saleCost").set_value(0);
+			node.append_attribute("singleChoice").set_value(0);
+			break;
+		case Object::Type::Crate:
+			node.append_attribute("type").set_value(0);
+			node.append_attribute("contents").set_value("no_item");
+			break;
+		default:
+			node.append_attribute("type").set_value(0);
+			break;
+		}
+	}
+}
+
+void generateSyntheticDungeon(pugi::xml_document & doc)
+{
+	pugi::xml_node dungeonNode = doc.append_child("dungeon");
+
+	for (std::size_t level = 0; level < SYNTHETIC_LEVEL_COUNT; ++level)
+	{
+		pugi::xml_node levelNode = dungeonNode.append_child("level");
+
+		for (std::size_t type = 0; type < std::size_t(Object::Type::TypeCount); ++type)
+		{
+			appendSyntheticObjects(levelNode, Object::Type(type));
+		}
+	}
+}
+
+/**
+ * Collects the names of all attributes of all object nodes, in document order.
+ */
+std::vector<const char *> collectAttributeNames(const pugi::xml_document & doc)
+{
+	std::vector<const char *> names;
+
+	for (const auto & levelNode : doc.child("dungeon"))
+	{
+		for (const auto & listNode : levelNode)
+		{
+			if (Object::getTypeByNamePlural(listNode.name()) == Object::Type::None)
+			{
+				continue;
+			}
+
+			for (const auto & objectNode : listNode)
+			{
+				for (auto attrib = objectNode.attributes_begin(); attrib != objectNode.attributes_end(); ++attrib)
+				{
+					names.push_back(attrib->name());
+				}
+			}
+		}
+	}
+
+	return names;
+}
+
+template<typename Func>
+void runBenchmark(const char * label, const std::vector<const char *> & names, Func dispatch)
+{
+	// Accumulate results to keep the lookups from being optimized out.
+	std::size_t checksum = 0;
+
+	sf::Clock clock;
+
+	for (std::size_t repeat = 0; repeat < REPEAT_COUNT; ++repeat)
+	{
+		for (const char * name : names)
+		{
+			checksum += std::size_t(dispatch(name));
+		}
+	}
+
+	double seconds = clock.getElapsedTime().asMicroseconds() / 1000000.0;
+	double lookups = double(names.size()) * REPEAT_COUNT;
+
+	std::printf("%-8s %10.2f ns/lookup %10.2f M lookups/s (checksum %zu)\n", label, seconds * 1e9 / lookups,
+			lookups / seconds / 1e6, checksum);
+}
+
+}
+
+int main(int argc, char ** argv)
+{
+	pugi::xml_document doc;
+
+	if (argc > 1)
+	{
+		if (!doc.load_file(argv[1]))
+		{
+			std::fprintf(stderr, "Failed to load dungeon '%s'\n", argv[1]);
+			return 1;
+		}
+	}
+	else
+	{
+		generateSyntheticDungeon(doc);
+	}
+
+	std::vector<const char *> names = collectAttributeNames(doc);
+
+	std::printf("%zu attributes, %zu repetitions\n", names.size(), REPEAT_COUNT);
+
+	// Verify that both implementations agree before timing them.
+	for (const char * name : names)
+	{
+		if (getPropertyByNameLinear(name) != Object::getPropertyByName(name))
+		{
+			std::fprintf(stderr, "Mismatch for attribute '%s'\n", name);
+			return 1;
+		}
+	}
+
+	runBenchmark("linear", names, getPropertyByNameLinear);
+	runBenchmark("hashed", names, [](const char * name) { return Object::getPropertyByName(name); });
+
+	return 0;
+}
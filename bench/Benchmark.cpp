@@ -0,0 +1,80 @@
+#include "Benchmark.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+
+volatile std::size_t sinkValue = 0;
+
+// upper limit for the number of batches of a single benchmark.
+const std::size_t maxRuns = 10000000;
+
+}
+
+void benchmarkSink(std::size_t value)
+{
+	sinkValue = sinkValue + value;
+}
+
+BenchmarkRunner::BenchmarkRunner(Format format, std::string filter, double minSeconds) :
+		format(format),
+		filter(filter),
+		minSeconds(minSeconds)
+{
+}
+
+bool BenchmarkRunner::isEnabled(const std::string& name) const
+{
+	return name.compare(0, filter.size(), filter) == 0;
+}
+
+void BenchmarkRunner::run(const std::string& name, std::size_t size, std::function<std::size_t()> batch,
+		std::function<void()> setup)
+{
+	if (!isEnabled(name))
+	{
+		return;
+	}
+
+	std::size_t runs = 0;
+	std::size_t operations = 0;
+
+	// sf::Time only has microsecond resolution, so summing per-batch sf::Times would count very short batches as zero
+	// and never reach the minimum time. the run limit ends the loop even if the clock does not advance at all.
+	std::chrono::steady_clock::duration elapsed(0);
+	std::chrono::duration<double> minDuration(minSeconds);
+
+	do
+	{
+		if (setup)
+		{
+			setup();
+		}
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		operations += batch();
+		elapsed += std::chrono::steady_clock::now() - start;
+		runs++;
+	}
+	while (elapsed < minDuration && runs < maxRuns);
+
+	double seconds = std::chrono::duration<double>(elapsed).count();
+	double nsPerOp = operations == 0 ? 0.0 : seconds * 1e9 / operations;
+	double opsPerSecond = seconds <= 0.0 ? 0.0 : operations / seconds;
+
+	if (format == Format::JSON)
+	{
+		std::printf("{\"benchmark\":\"%s\",\"size\":%zu,\"runs\":%zu,\"operations\":%zu,\"seconds\":%.6f,"
+				"\"ns_per_op\":%.3f,\"ops_per_second\":%.1f}\n", name.c_str(), size, runs, operations, seconds, nsPerOp,
+				opsPerSecond);
+	}
+	else
+	{
+		std::printf("%-32s %10zu %12.3f ns/op %14.1f ops/s (%zu runs)\n", name.c_str(), size, nsPerOp, opsPerSecond,
+				runs);
+	}
+
+	std::fflush(stdout);
+}
@@ -0,0 +1,52 @@
+#ifndef BENCH_BENCHMARK_HPP
+#define BENCH_BENCHMARK_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+/**
+ * Runs named benchmarks and prints one result line per benchmark.
+ *
+ * A benchmark function performs one batch of work and returns the number of operations it performed. The runner calls
+ * it repeatedly until the minimum measurement time has passed and reports the average time per operation.
+ */
+class BenchmarkRunner
+{
+public:
+
+	enum class Format
+	{
+		Text,
+		JSON
+	};
+
+	BenchmarkRunner(Format format, std::string filter, double minSeconds);
+
+	/**
+	 * Runs the benchmark with the specified name and problem size, unless its name does not start with the filter.
+	 *
+	 * The optional setup function is called before each batch and is not included in the measured time. At most ten
+	 * million batches are run, even if they take less than the minimum time in total.
+	 */
+	void run(const std::string & name, std::size_t size, std::function<std::size_t()> batch,
+			std::function<void()> setup = nullptr);
+
+	/**
+	 * Returns true if a benchmark with the specified name would be run. Allows skipping expensive preparation.
+	 */
+	bool isEnabled(const std::string & name) const;
+
+private:
+
+	Format format;
+	std::string filter;
+	double minSeconds;
+};
+
+/**
+ * Consumes a value so that the computation producing it is not optimized away.
+ */
+void benchmarkSink(std::size_t value);
+
+#endif
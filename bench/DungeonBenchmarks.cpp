@@ -0,0 +1,82 @@
+#include "Benchmark.hpp"
+#include "Suites.hpp"
+
+#include <Shared/Level/Dungeon.hpp>
+#include <Shared/Level/Level.hpp>
+#include <string>
+
+namespace
+{
+
+struct DungeonSize
+{
+	std::size_t levelCount;
+	int levelSize;
+};
+
+const DungeonSize DUNGEON_SIZES[] = { { 1, 32 }, { 4, 64 }, { 8, 128 }, { 16, 256 } };
+
+std::size_t countElements(const Dungeon & dungeon)
+{
+	std::size_t elements = 0;
+
+	for (std::size_t i = 0; i < dungeon.getLevelCount(); ++i)
+	{
+		const Level & level = dungeon.getLevel(i);
+
+		for (auto it = level.tilesBegin(); it != level.tilesEnd(); ++it)
+		{
+			elements++;
+		}
+
+		for (auto it = level.objectsBegin(); it != level.objectsEnd(); ++it)
+		{
+			elements++;
+		}
+	}
+
+	return elements;
+}
+
+}
+
+void runDungeonBenchmarks(BenchmarkRunner & runner)
+{
+	// The XML is processed in memory (the same code path as loadFromXML()/saveToXML() minus file access) so that disk
+	// caching does not affect the results. Operations are XML elements (tiles and objects).
+	for (const DungeonSize & dungeonSize : DUNGEON_SIZES)
+	{
+		if (!runner.isEnabled("dungeon.saveXML") && !runner.isEnabled("dungeon.loadXML"))
+		{
+			return;
+		}
+
+		DungeonGenerator generator;
+		generator.setConfig(getBenchmarkDungeonConfig(dungeonSize.levelCount, dungeonSize.levelSize));
+
+		Dungeon dungeon;
+		generator.generate(dungeon);
+
+		std::size_t elements = countElements(dungeon);
+		std::string xmlData;
+
+		runner.run("dungeon.saveXML", elements, [&]()
+		{
+			xmlData = dungeon.saveToXMLString("bench.xml");
+			return elements;
+		});
+
+		if (xmlData.empty())
+		{
+			xmlData = dungeon.saveToXMLString("bench.xml");
+		}
+
+		runner.run("dungeon.loadXML", elements, [&]()
+		{
+			Dungeon loadedDungeon;
+			loadedDungeon.loadFromXMLString(xmlData, "bench.xml");
+			benchmarkSink(loadedDungeon.getLevelCount());
+			return elements;
+		});
+	}
+}
@@ -0,0 +1,81 @@
+#include "Benchmark.hpp"
+#include "Suites.hpp"
+
+#include <Shared/Level/Level.hpp>
+#include <Shared/Utils/Event/EventListener.hpp>
+#include <Shared/Utils/Event/EventManager.hpp>
+
+namespace
+{
+
+const std::size_t EVENT_BATCH_SIZES[] = { 16, 1024, 65536 };
+
+}
+
+void runEventBenchmarks(BenchmarkRunner & runner)
+{
+	for (std::size_t batchSize : EVENT_BATCH_SIZES)
+	{
+		EventManager<Level::Event> manager;
+		EventListener<Level::Event> listener = manager.acquireListener();
+
+		Level::Event event;
+		event.type = Level::Event::TileChanged;
+
+		// Push a batch of events, then drain the listener, like a level edit followed by a renderer update.
+		runner.run("event.pushPoll", batchSize, [&]()
+		{
+			for (std::size_t i = 0; i < batchSize; ++i)
+			{
+				event.tilePosition.x = int(i);
+				manager.push(event);
+			}
+
+			Level::Event polledEvent;
+			std::size_t polled = 0;
+
+			while (listener.poll(polledEvent))
+			{
+				polled++;
+			}
+
+			benchmarkSink(polled);
+			return batchSize;
+		});
+
+		// Repeatedly changing the same tile, like a brush held in place. All but the first event are coalesced.
+		runner.run("event.pushCoalesced", batchSize, [&]()
+		{
+			event.tilePosition.x = 0;
+
+			for (std::size_t i = 0; i < batchSize; ++i)
+			{
+				manager.push(event);
+			}
+
+			Level::Event polledEvent;
+			std::size_t polled = 0;
+
+			while (listener.poll(polledEvent))
+			{
+				polled++;
+			}
+
+			benchmarkSink(polled);
+			return batchSize;
+		});
+
+		// Pushing to a manager without listeners.
+		EventManager<Level::Event> idleManager;
+
+		runner.run("event.pushUnobserved", batchSize, [&]()
+		{
+			for (std::size_t i = 0; i < batchSize; ++i)
+			{
+				event.tilePosition.x = int(i);
+				idleManager.push(event);
+			}
+			return batchSize;
+		});
+	}
+}
@@ -0,0 +1,111 @@
+#include "Benchmark.hpp"
+#include "Suites.hpp"
+
+#include <Shared/Editor/Brush.hpp>
+#include <Shared/Level/Level.hpp>
+#include <Shared/Utils/MakeUnique.hpp>
+#include <Shared/Utils/Utilities.hpp>
+#include <memory>
+#include <string>
+
+namespace
+{
+
+const int LEVEL_SIZES[] = { 64, 256, 1024 };
+const int BRUSH_STROKE_COUNT = 16;
+
+}
+
+void runLevelBenchmarks(BenchmarkRunner & runner)
+{
+	for (int size : LEVEL_SIZES)
+	{
+		std::size_t tileCount = std::size_t(size) * size;
+
+		std::unique_ptr<Level> level;
+
+		runner.run("level.setTileAt", tileCount, [&]()
+		{
+			for (int y = 0; y < size; ++y)
+			{
+				for (int x = 0; x < size; ++x)
+				{
+					level->setTileAt(sf::Vector2i(x, y), Tile((x ^ y) & 1 ? 100 : 0));
+				}
+			}
+			return tileCount;
+		}, [&]()
+		{
+			level = makeUnique<Level>();
+		});
+
+		// Remaining benchmarks share one generated level.
+		DungeonGenerator generator;
+		generator.setConfig(getBenchmarkDungeonConfig(1, size));
+
+		level = makeUnique<Level>();
+		generator.generateLevel(*level);
+
+		runner.run("level.getTileAt", tileCount, [&]()
+		{
+			std::size_t existing = 0;
+			for (int y = 0; y < size; ++y)
+			{
+				for (int x = 0; x < size; ++x)
+				{
+					existing += level->getTileAt(sf::Vector2i(x, y)).exists();
+				}
+			}
+			benchmarkSink(existing);
+			return tileCount;
+		});
+
+		runner.run("level.getObjectsAt", tileCount, [&]()
+		{
+			std::size_t objects = 0;
+			for (int y = 0; y < size; ++y)
+			{
+				for (int x = 0; x < size; ++x)
+				{
+					objects += level->getObjectsAt(sf::Vector2i(x, y)).size();
+				}
+			}
+			benchmarkSink(objects);
+			return tileCount;
+		});
+
+		runner.run("level.iterateTiles", tileCount, [&]()
+		{
+			std::size_t tiles = 0;
+			for (auto it = level->tilesBegin(); it != level->tilesEnd(); ++it)
+			{
+				tiles += it.getTile().id;
+			}
+			benchmarkSink(tiles);
+			return tileCount;
+		});
+
+		// Brush strokes: diagonal lines across the level, as drawn by the brush tool with the mouse held down.
+		Brush brush;
+		brush.setTile(Tile(1, Tile::Zone2));
+		brush.setTileMode(Brush::TileMode::ReplaceAny);
+		brush.setTileMask(Brush::TileMask::Full);
+		brush.setObject(Object(Object::Type::Trap));
+		brush.setObjectMode(Brush::ObjectMode::ReplaceTopMostOrCreate);
+
+		runner.run("brush.stroke", tileCount, [&]()
+		{
+			std::size_t strokePoints = 0;
+			for (int stroke = 0; stroke < BRUSH_STROKE_COUNT; ++stroke)
+			{
+				int offset = stroke * size / BRUSH_STROKE_COUNT;
+				plotBresenham(offset, 0, size - 1, size - 1 - offset, [&](int x, int y)
+				{
+					level->applyBrush(sf::Vector2i(x, y), brush);
+					strokePoints++;
+				});
+			}
+			return strokePoints;
+		});
+	}
+}
@@ -0,0 +1,66 @@
+/*
+ * Microbenchmark suite for level editing, dungeon I/O, events, rendering and utility hot paths.
+ *
+ * Usage: necroedit-bench [--format text|json] [--filter <prefix>] [--min-time <seconds>]
+ *
+ * With --format json, each result is printed as one JSON object per line, suitable for comparing runs between
+ * releases.
+ */
+
+#include "Benchmark.hpp"
+#include "Suites.hpp"
+
+#include <Shared/Utils/StrNumCon.hpp>
+#include <cstdio>
+#include <string>
+
+DungeonGenerator::Config getBenchmarkDungeonConfig(std::size_t levelCount, int levelSize)
+{
+	DungeonGenerator::Config config;
+	config.levelCount = levelCount;
+	config.levelSize = sf::Vector2i(levelSize, levelSize);
+	config.objectDensity = 0.125f;
+	return config;
+}
+
+int main(int argc, char ** argv)
+{
+	BenchmarkRunner::Format format = BenchmarkRunner::Format::Text;
+	std::string filter;
+	double minSeconds = 0.2;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+
+		if (arg == "--format" && i + 1 < argc)
+		{
+			std::string value = argv[++i];
+			format = value == "json" ? BenchmarkRunner::Format::JSON : BenchmarkRunner::Format::Text;
+		}
+		else if (arg == "--filter" && i + 1 < argc)
+		{
+			filter = argv[++i];
+		}
+		else if (arg == "--min-time" && i + 1 < argc)
+		{
+			minSeconds = cStoD(argv[++i]);
+		}
+		else
+		{
+			std::fprintf(stderr, "Usage: %s [--format text|json] [--filter <prefix>] [--min-time <seconds>]\n",
+					argv[0]);
+			return 2;
+		}
+	}
+
+	BenchmarkRunner runner(format, filter, minSeconds);
+
+	runLevelBenchmarks(runner);
+	runDungeonBenchmarks(runner);
+	runEventBenchmarks(runner);
+	runRendererBenchmarks(runner);
+	runUtilityBenchmarks(runner);
+
+	return 0;
+}
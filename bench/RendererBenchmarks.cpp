@@ -0,0 +1,125 @@
+#include "Benchmark.hpp"
+#include "Suites.hpp"
+
+#include <Client/Graphics/Packing/ITexturePacker.hpp>
+#include <Client/LevelRenderer/LevelRenderer.hpp>
+#include <Client/LevelRenderer/LevelRendererCache.hpp>
+#include <Client/LevelRenderer/ObjectAppearance.hpp>
+#include <Client/LevelRenderer/TileAppearance.hpp>
+#include <Shared/Level/Dungeon.hpp>
+#include <Shared/Level/Level.hpp>
+#include <Shared/Utils/MakeUnique.hpp>
+#include <memory>
+
+namespace
+{
+
+// Renderer construction currently scales quadratically with the tile count, so larger levels take minutes.
+const int LEVEL_SIZES[] = { 64, 128, 256 };
+
+/**
+ * Texture packer that stores nothing, so that appearance managers can be created without a graphics context.
+ */
+class NullTexturePacker : public ITexturePacker
+{
+public:
+
+	NodeID add(const sf::Image & image) override
+	{
+		return packFailure;
+	}
+
+	void clear() override
+	{
+	}
+
+	bool empty() const override
+	{
+		return true;
+	}
+
+	sf::IntRect getImageRect(NodeID index) const override
+	{
+		return sf::IntRect();
+	}
+
+	const sf::Texture * getTexture() const override
+	{
+		return nullptr;
+	}
+
+	void setSmooth(bool smooth) override
+	{
+	}
+};
+
+}
+
+void runRendererBenchmarks(BenchmarkRunner & runner)
+{
+	// Appearance data comes from the game's resource files, which are not available here. Without it, the renderer
+	// generates no vertices, so these benchmarks measure the renderer's bookkeeping: event handling, tile layer
+	// assignment and vertex array management.
+	NullTexturePacker packer;
+	TileAppearanceManager tileAppearance(&packer);
+	ObjectAppearanceManager objectAppearance(&packer);
+
+	for (int size : LEVEL_SIZES)
+	{
+		if (!runner.isEnabled("renderer."))
+		{
+			return;
+		}
+
+		DungeonGenerator generator;
+		generator.setConfig(getBenchmarkDungeonConfig(1, size));
+
+		Dungeon dungeon;
+		generator.generate(dungeon);
+		Level & level = dungeon.getLevel(0);
+
+		std::size_t tileCount = std::size_t(size) * size;
+
+		runner.run("renderer.construct", tileCount, [&]()
+		{
+			LevelRenderer renderer(dungeon, level, tileAppearance, objectAppearance);
+			return tileCount;
+		});
+
+		// Update after changing a row of tiles, as happens during a brush stroke.
+		std::unique_ptr<LevelRenderer> renderer = makeUnique<LevelRenderer>(dungeon, level, tileAppearance,
+				objectAppearance);
+		int row = 0;
+
+		runner.run("renderer.updateRow", std::size_t(size), [&]()
+		{
+			renderer->update();
+			return std::size_t(size);
+		}, [&]()
+		{
+			for (int x = 0; x < size; ++x)
+			{
+				Tile tile = level.getTileAt(sf::Vector2i(x, row));
+				tile.id = tile.id == 0 ? 1 : 0;
+				level.setTileAt(sf::Vector2i(x, row), tile);
+			}
+			row = (row + 1) % size;
+		});
+
+		// Switch back and forth between two levels through the renderer cache, as the editor does.
+		generator.setConfig(getBenchmarkDungeonConfig(2, size));
+
+		Dungeon switchDungeon;
+		generator.generate(switchDungeon);
+
+		LevelRendererCache cache(switchDungeon, tileAppearance, objectAppearance);
+		std::size_t switchLevel = 0;
+
+		runner.run("renderer.switchCached", tileCount, [&]()
+		{
+			switchLevel = 1 - switchLevel;
+			cache.acquire(switchDungeon.getLevel(switchLevel));
+			return tileCount;
+		});
+	}
+}
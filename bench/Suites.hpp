@@ -0,0 +1,21 @@
+#ifndef BENCH_SUITES_HPP
+#define BENCH_SUITES_HPP
+
+#include <Shared/Editor/DungeonGenerator.hpp>
+#include <cstddef>
+
+class BenchmarkRunner;
+
+void runLevelBenchmarks(BenchmarkRunner & runner);
+void runDungeonBenchmarks(BenchmarkRunner & runner);
+void runEventBenchmarks(BenchmarkRunner & runner);
+void runRendererBenchmarks(BenchmarkRunner & runner);
+void runUtilityBenchmarks(BenchmarkRunner & runner);
+
+/**
+ * Returns the generator configuration used for the benchmark input: square levels of the specified size with one
+ * object per 8 floor tiles, using a fixed seed so that runs are comparable.
+ */
+DungeonGenerator::Config getBenchmarkDungeonConfig(std::size_t levelCount, int levelSize);
+
+#endif
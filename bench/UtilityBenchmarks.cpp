@@ -0,0 +1,91 @@
+#include "Benchmark.hpp"
+#include "Suites.hpp"
+
+#include <Shared/Utils/DataStream.hpp>
+#include <Shared/Utils/SearchIndex.hpp>
+#include <Shared/Utils/StrNumCon.hpp>
+#include <Shared/Utils/Utilities.hpp>
+#include <SFML/Config.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const std::size_t ELEMENT_COUNTS[] = { 64, 4096, 262144 };
+
+}
+
+void runUtilityBenchmarks(BenchmarkRunner & runner)
+{
+	for (std::size_t count : ELEMENT_COUNTS)
+	{
+		// A long separated line, like a row of a resource table.
+		std::string line;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			line += (i == 0 ? "" : ",") + cNtoS(i);
+		}
+
+		runner.run("utils.splitString", count, [&]()
+		{
+			benchmarkSink(splitString(line, ",").size());
+			return count;
+		});
+
+		// Resource file lines with sections of 16 lines each. Extract the last section to scan the whole file.
+		std::vector<std::string> lines;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			lines.push_back(i % 16 == 0 ? "[section" + cNtoS(i / 16) + "]" : "key" + cNtoS(i) + " = value");
+		}
+		std::string lastSection = "section" + cNtoS((count - 1) / 16);
+
+		runner.run("utils.extractSection", count, [&]()
+		{
+			benchmarkSink(extractSection(lines, lastSection).size());
+			return count;
+		});
+
+		// Round trip of a vector of integers and strings through a memory data stream.
+		std::vector<sf::Uint32> numbers(count);
+		std::vector<std::string> strings(count / 16 + 1, "some_item_name");
+
+		runner.run("utils.dataStreamRoundTrip", count, [&]()
+		{
+			DataStream stream;
+			stream.openMemory();
+			stream.setIndexSize(4);
+			stream << numbers << strings;
+
+			std::vector<sf::Uint32> readNumbers;
+			std::vector<std::string> readStrings;
+			stream.seek(0);
+			stream >> readNumbers >> readStrings;
+
+			benchmarkSink(readNumbers.size() + readStrings.size());
+			return count;
+		});
+
+		// Palette search: a few keystrokes of a query against item names.
+		std::vector<std::string> names;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			names.push_back((i % 3 == 0 ? "weapon_dagger_" : i % 3 == 1 ? "armor_leather_" : "food_") + cNtoS(i));
+		}
+		SearchIndex index(names);
+		std::vector<std::size_t> results;
+
+		runner.run("utils.searchIndexFind", count, [&]()
+		{
+			std::size_t found = 0;
+			for (const char * query : { "d", "da", "dag", "dagger_1", "ther_2" })
+			{
+				index.find(query, results);
+				found += results.size();
+			}
+			benchmarkSink(found);
+			return count;
+		});
+	}
+}
@@ -7,7 +7,8 @@
 #include <SFML/Window/Mouse.hpp>
 #include <Shared/Level/Dungeon.hpp>
 #include <Shared/Level/Level.hpp>
-#include <Shared/Utils/MakeUnique.hpp>
+#include <Shared/Utils/MemoryUsage.hpp>
+#include <Shared/Utils/Profiler.hpp>
 #include <cmath>
 
 gui2::Ptr<Editor> Editor::make(Dungeon & dungeon, const TileAppearanceManager & tileAppearance,
@@ -24,6 +25,7 @@ Editor::Editor(Dungeon & dungeon, const TileAppearanceManager & tileAppearance,
 		tool(nullptr),
 		tileAppearance(&tileAppearance),
 		objectAppearance(&objectAppearance),
+		levelRendererCache(dungeon, tileAppearance, objectAppearance),
 		levelRenderer(nullptr),
 		lastLeftMouseDown(false),
 		lastRightMouseDown(false),
@@ -50,7 +52,7 @@ void Editor::setLevel(Level * level)
 		}
 		else
 		{
-			levelRenderer = makeUnique<LevelRenderer>(*dungeon, *level, *tileAppearance, *objectAppearance);
+			levelRenderer = &levelRendererCache.acquire(*level);
 		}
 	}
 }
@@ -88,6 +90,27 @@ bool Editor::isVertexRenderable() const
 	return false;
 }
 
+void Editor::getMemoryUsage(MemoryUsage & usage) const
+{
+	gui2::Widget::getMemoryUsage(usage);
+	usage.add("vertex caches", MemoryUsage::getVectorBytes(tilePreviewVertices), tilePreviewVertices.size());
+}
+
+void Editor::getLevelRendererMemoryUsage(MemoryUsage & usage) const
+{
+	levelRendererCache.getMemoryUsage(usage);
+}
+
+void Editor::setLevelRendererCacheLimit(std::size_t bytes)
+{
+	levelRendererCache.setMemoryLimit(bytes);
+}
+
+std::size_t Editor::getLevelRendererCacheLimit() const
+{
+	return levelRendererCache.getMemoryLimit();
+}
+
 void Editor::init()
 {
 	Widget::init();
@@ -116,6 +139,12 @@ void Editor::onDraw(sf::RenderTarget & target, sf::RenderStates states) const
 	if (levelRenderer != nullptr)
 	{
 		target.draw(*levelRenderer, states);
+
+		// Level events pushed after the editor was processed are only applied in the next frame.
+		if (levelRenderer->getPendingEventCount() > 0)
+		{
+			requestUpdate();
+		}
 	}
 
 	if (getTool() != nullptr && isMouseOver())
@@ -174,6 +203,9 @@ void Editor::onProcess(const gui2::WidgetEvents& events)
 
 		static constexpr float ZOOM_FACTOR_FRICTION = 0.75f;
 		zoomVelocity *= ZOOM_FACTOR_FRICTION;
+
+		// Keep producing frames until the zoom animation has stopped.
+		requestUpdate();
 	}
 
 	mousePos = convertMousePosition(events.mousePosition);
@@ -183,6 +215,8 @@ void Editor::onProcess(const gui2::WidgetEvents& events)
 
 	if (getTool() != nullptr)
 	{
+		ProfileZone zone("Editor::toolInput");
+
 		if (leftMouseDown && !lastLeftMouseDown)
 		{
 			getTool()->onMousePress(tileAtMousePos, Tool::MouseButton::Left);
@@ -3,6 +3,7 @@
 
 #include <Client/GUI2/GUI.hpp>
 #include <Client/GUI2/Widget.hpp>
+#include <Client/LevelRenderer/LevelRendererCache.hpp>
 #include <Client/LevelRenderer/ObjectAppearance.hpp>
 #include <Client/LevelRenderer/TileAppearance.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
@@ -16,6 +17,7 @@ class Dungeon;
 
 class Level;
 class LevelRenderer;
+class MemoryUsage;
 class Tool;
 
 namespace gui2
@@ -58,6 +60,22 @@ public:
 
 	bool isVertexRenderable() const override;
 
+	void getMemoryUsage(MemoryUsage & usage) const override;
+
+	/**
+	 * Adds the estimated memory used by the renderers of the current and recently displayed levels to the specified
+	 * object.
+	 *
+	 * This is kept separate from getMemoryUsage() so that renderer memory can be reported independently of the GUI.
+	 */
+	void getLevelRendererMemoryUsage(MemoryUsage & usage) const;
+
+	/**
+	 * Sets the memory limit for renderers of previously displayed levels, which are kept to speed up switching levels.
+	 */
+	void setLevelRendererCacheLimit(std::size_t bytes);
+	std::size_t getLevelRendererCacheLimit() const;
+
 private:
 
 	void init() override;
@@ -76,7 +94,8 @@ private:
 	const TileAppearanceManager * tileAppearance;
 	const ObjectAppearanceManager * objectAppearance;
 
-	std::unique_ptr<LevelRenderer> levelRenderer;
+	LevelRendererCache levelRendererCache;
+	LevelRenderer * levelRenderer;
 
 	sf::RectangleShape tilePreviewRectangle;
 	std::vector<sf::Vertex> tilePreviewVertices;
@@ -7,14 +7,17 @@
 #include <SFML/Graphics/Color.hpp>
 #include <Shared/Level/Dungeon.hpp>
 #include <Shared/Level/Level.hpp>
+#include <Shared/Utils/MemoryUsage.hpp>
 #include <Shared/Utils/StrNumCon.hpp>
 #include <algorithm>
 #include <cmath>
 #include <iterator>
 #include <memory>
 
-static constexpr float LEVEL_LIST_ENTRY_HEIGHT = 20.f;
+static constexpr float LEVEL_LIST_ENTRY_HEIGHT = 40.f;
 static constexpr float SLIDER_WIDTH = 16.f;
+static constexpr unsigned int THUMBNAIL_WIDTH = 64;
+static constexpr unsigned int THUMBNAIL_HEIGHT = 36;
 
 gui2::Ptr<LevelPanel> LevelPanel::make()
 {
@@ -90,6 +93,11 @@ void LevelPanel::init()
 
 	add(mainPanelContainer);
 
+	// The panel rarely changes, so it is drawn from an off-screen texture.
+	setRenderCacheEnabled(true);
+
+	thumbnailCache.setThumbnailSize(sf::Vector2u(THUMBNAIL_WIDTH, THUMBNAIL_HEIGHT));
+
 	deleteConfirmMessage = gui2::MessageBox::make("Are you sure you want to delete this level?", "Confirmation", {
 		"Yes",
 		"No" });
@@ -193,9 +201,21 @@ Dungeon * LevelPanel::getDungeon() const
 void LevelPanel::setDungeon(Dungeon * dungeon)
 {
 	this->dungeon = dungeon;
+	thumbnailCache.clear();
 	updateDungeon();
 }
 
+void LevelPanel::setTileAppearance(const TileAppearanceManager * tileAppearance)
+{
+	thumbnailCache.setTileAppearance(tileAppearance);
+}
+
+void LevelPanel::getMemoryUsage(MemoryUsage & usage) const
+{
+	gui2::Container::getMemoryUsage(usage);
+	thumbnailCache.getMemoryUsage(usage);
+}
+
 void LevelPanel::updateDungeon()
 {
 	while (levelListEntries.size() < dungeon->getLevelCount())
@@ -203,6 +223,8 @@ void LevelPanel::updateDungeon()
 		std::size_t levelID = levelListEntries.size();
 		levelListEntries.push_back(gui2::Text::make(" Level " + cNtoS(levelID + 1)));
 		levelListInnerContainer->add(levelListEntries.back());
+		levelListThumbnails.push_back(gui2::Image::make());
+		levelListInnerContainer->add(levelListThumbnails.back());
 		updateLevelListEntryRect(levelID);
 		setLevelListEntryColor(levelID, false);
 	}
@@ -211,8 +233,13 @@ void LevelPanel::updateDungeon()
 	{
 		levelListInnerContainer->remove(levelListEntries.back());
 		levelListEntries.pop_back();
+		levelListInnerContainer->remove(levelListThumbnails.back());
+		levelListThumbnails.pop_back();
 	}
 
+	// Levels may have been removed, moved or replaced.
+	thumbnailCache.removeUnusedThumbnails(*dungeon);
+
 	levelListInnerContainer->setSize(levelListInnerContainer->getSize().x,
 		levelListEntries.size() * LEVEL_LIST_ENTRY_HEIGHT);
 
@@ -268,6 +295,10 @@ void LevelPanel::updateLevelListEntryRect(std::size_t level)
 	{
 		levelListEntries[level]->setRect(0, level * LEVEL_LIST_ENTRY_HEIGHT, getSize().x - SLIDER_WIDTH,
 			LEVEL_LIST_ENTRY_HEIGHT);
+
+		float thumbnailMargin = (LEVEL_LIST_ENTRY_HEIGHT - THUMBNAIL_HEIGHT) / 2.f;
+		levelListThumbnails[level]->setRect(getSize().x - SLIDER_WIDTH - THUMBNAIL_WIDTH - thumbnailMargin,
+			level * LEVEL_LIST_ENTRY_HEIGHT + thumbnailMargin, THUMBNAIL_WIDTH, THUMBNAIL_HEIGHT);
 	}
 }
 
@@ -317,13 +348,47 @@ void LevelPanel::updateSlider()
 	}
 }
 
+void LevelPanel::updateThumbnails()
+{
+	// The panel is drawn from its render cache, which does not notice textures changing in place.
+	if (thumbnailCache.update())
+	{
+		for (const auto & thumbnail : levelListThumbnails)
+		{
+			thumbnail->invalidateRender();
+		}
+	}
+
+	if (dungeon == nullptr)
+	{
+		return;
+	}
+
+	// Only request thumbnails for visible entries.
+	float scroll = levelListSlider->isEnabled() ? levelListSlider->getValue() : 0.f;
+	std::size_t firstVisible = std::max(scroll, 0.f) / LEVEL_LIST_ENTRY_HEIGHT;
+	std::size_t lastVisible = (scroll + levelListContainer->getSize().y) / LEVEL_LIST_ENTRY_HEIGHT;
+
+	for (std::size_t i = 0; i < levelListThumbnails.size() && i < dungeon->getLevelCount(); ++i)
+	{
+		if (i >= firstVisible && i <= lastVisible)
+		{
+			levelListThumbnails[i]->setTexture(thumbnailCache.getThumbnail(dungeon->getLevel(i)));
+		}
+	}
+
+	// Keep processing frames until all requested thumbnails have been uploaded.
+	if (thumbnailCache.isUpdatePending())
+	{
+		requestUpdate();
+	}
+}
+
 void LevelPanel::onProcessContainer(gui2::WidgetEvents& events)
 {
 	for (std::size_t i = 0; i < levelListEntries.size(); ++i)
 	{
-		auto levelEntry = levelListEntries[i];
-
-		if (levelEntry->isMouseDown())
+		if (levelListEntries[i]->isMouseDown() || levelListThumbnails[i]->isMouseDown())
 		{
 			selectLevel(i);
 		}
@@ -383,6 +448,8 @@ void LevelPanel::onProcessContainer(gui2::WidgetEvents& events)
 	levelListInnerContainer->setPosition(0.f, -levelListSlider->getValue());
 	levelListInnerContainer->setSize(levelListContainer->getSize().x, levelListInnerContainer->getSize().y);
 
+	updateThumbnails();
+
 	if (dungeon != nullptr)
 	{
 		if (buttonAddLevel->isClicked())
@@ -1,9 +1,11 @@
 #ifndef SRC_CLIENT_EDITOR_LEVELPANEL_HPP_
 #define SRC_CLIENT_EDITOR_LEVELPANEL_HPP_
 
+#include <Client/Editor/LevelThumbnailCache.hpp>
 #include <Client/GUI2/GUI.hpp>
 #include <Client/GUI2/Widgets/Button.hpp>
 #include <Client/GUI2/Widgets/Dropdown.hpp>
+#include <Client/GUI2/Widgets/Image.hpp>
 #include <Client/GUI2/Widgets/MessageBox.hpp>
 #include <Client/GUI2/Widgets/Slider.hpp>
 #include <Client/GUI2/Widgets/Text.hpp>
@@ -13,6 +15,8 @@
 #include <vector>
 
 class Dungeon;
+class MemoryUsage;
+class TileAppearanceManager;
 
 namespace gui2
 {
@@ -45,6 +49,13 @@ public:
 
 	void updateDungeon();
 
+	/**
+	 * Sets the appearance manager used to color the level thumbnails.
+	 */
+	void setTileAppearance(const TileAppearanceManager * tileAppearance);
+
+	void getMemoryUsage(MemoryUsage & usage) const override;
+
 	bool wasChanged();
 
 	LevelPanel();
@@ -63,6 +74,7 @@ private:
 	void updateLevelButtons();
 	void updateDropdowns();
 	void updateSlider();
+	void updateThumbnails();
 
 	void onResize();
 
@@ -79,6 +91,9 @@ private:
 	gui2::Ptr<gui2::Container> levelListContainer;
 	gui2::Ptr<gui2::Container> levelListInnerContainer;
 	std::vector<gui2::Ptr<gui2::Text>> levelListEntries;
+	std::vector<gui2::Ptr<gui2::Image>> levelListThumbnails;
+
+	LevelThumbnailCache thumbnailCache;
 
 	gui2::Ptr<gui2::Slider> levelListSlider;
 	float scrollVelocity;
@@ -0,0 +1,370 @@
+#include <Client/Editor/LevelThumbnailCache.hpp>
+#include <Client/LevelRenderer/TileAppearance.hpp>
+#include <Shared/Level/Dungeon.hpp>
+#include <Shared/Utils/MakeUnique.hpp>
+#include <Shared/Utils/MemoryUsage.hpp>
+#include <Shared/Utils/Profiler.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <utility>
+
+/**
+ * Upper limit for the number of pixels per tile, to keep small levels from turning into a few large blocks.
+ */
+static constexpr float MAX_PIXELS_PER_TILE = 4.f;
+
+LevelThumbnailCache::LevelThumbnailCache() :
+	tileAppearance(nullptr),
+	thumbnailSize(64, 36),
+	refreshDelay(sf::milliseconds(500)),
+	nextJobID(0),
+	isStopping(false)
+{
+}
+
+LevelThumbnailCache::~LevelThumbnailCache()
+{
+	stopWorker();
+}
+
+void LevelThumbnailCache::setTileAppearance(const TileAppearanceManager * tileAppearance)
+{
+	if (this->tileAppearance != tileAppearance)
+	{
+		this->tileAppearance = tileAppearance;
+		clear();
+	}
+}
+
+const TileAppearanceManager * LevelThumbnailCache::getTileAppearance() const
+{
+	return tileAppearance;
+}
+
+void LevelThumbnailCache::setThumbnailSize(sf::Vector2u size)
+{
+	if (thumbnailSize != size)
+	{
+		thumbnailSize = size;
+		clear();
+	}
+}
+
+sf::Vector2u LevelThumbnailCache::getThumbnailSize() const
+{
+	return thumbnailSize;
+}
+
+void LevelThumbnailCache::setRefreshDelay(sf::Time delay)
+{
+	refreshDelay = delay;
+}
+
+sf::Time LevelThumbnailCache::getRefreshDelay() const
+{
+	return refreshDelay;
+}
+
+const sf::Texture * LevelThumbnailCache::getThumbnail(const Level & level)
+{
+	auto it = entries.find(&level);
+
+	// The level at this address may have replaced a destroyed one.
+	if (it != entries.end() && !it->second.listener.isConnected())
+	{
+		entries.erase(it);
+		it = entries.end();
+	}
+
+	if (it == entries.end())
+	{
+		Entry & entry = entries[&level];
+		entry.listener = level.acquireEventListener();
+		entry.isOutdated = true;
+		entry.pendingJobID = 0;
+		return nullptr;
+	}
+
+	return it->second.texture.get();
+}
+
+void LevelThumbnailCache::removeUnusedThumbnails(const Dungeon & dungeon)
+{
+	std::set<const Level *> levels;
+
+	for (std::size_t i = 0; i < dungeon.getLevelCount(); ++i)
+	{
+		levels.insert(&dungeon.getLevel(i));
+	}
+
+	for (auto it = entries.begin(); it != entries.end(); )
+	{
+		if (levels.count(it->first) == 0 || !it->second.listener.isConnected())
+		{
+			it = entries.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+void LevelThumbnailCache::clear()
+{
+	// Jobs that are still running for removed entries are ignored once they finish.
+	entries.clear();
+}
+
+bool LevelThumbnailCache::update()
+{
+	ProfileZone zone("LevelThumbnailCache::update");
+
+	std::vector<Result> finishedResults;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		finishedResults.swap(results);
+	}
+
+	bool uploaded = false;
+
+	for (Result & result : finishedResults)
+	{
+		for (auto & entry : entries)
+		{
+			if (entry.second.pendingJobID == result.jobID)
+			{
+				if (entry.second.texture == nullptr)
+				{
+					entry.second.texture = makeUnique<sf::Texture>();
+					entry.second.texture->create(thumbnailSize.x, thumbnailSize.y);
+				}
+
+				entry.second.texture->update(result.pixels.data());
+				entry.second.pendingJobID = 0;
+				uploaded = true;
+				break;
+			}
+		}
+	}
+
+	for (auto it = entries.begin(); it != entries.end(); )
+	{
+		// Skip thumbnails of destroyed levels.
+		if (!it->second.listener.isConnected())
+		{
+			it = entries.erase(it);
+			continue;
+		}
+
+		auto & entry = *it++;
+		Level::Event event;
+
+		while (entry.second.listener.poll(event))
+		{
+			switch (event.type)
+			{
+			case Level::Event::TileAdded:
+			case Level::Event::TileChanged:
+			case Level::Event::TileRemoved:
+				entry.second.isOutdated = true;
+				break;
+
+			default:
+				break;
+			}
+		}
+
+		// Thumbnails of levels that are being edited are refreshed at a limited rate.
+		if (entry.second.isOutdated && entry.second.pendingJobID == 0
+			&& (entry.second.texture == nullptr || entry.second.refreshClock.getElapsedTime() >= refreshDelay))
+		{
+			startJob(*entry.first, entry.second);
+		}
+	}
+
+	return uploaded;
+}
+
+bool LevelThumbnailCache::isUpdatePending() const
+{
+	for (const auto & entry : entries)
+	{
+		if (entry.second.isOutdated || entry.second.pendingJobID != 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void LevelThumbnailCache::getMemoryUsage(MemoryUsage & usage) const
+{
+	std::size_t textureCount = 0;
+
+	for (const auto & entry : entries)
+	{
+		if (entry.second.texture != nullptr)
+		{
+			textureCount++;
+		}
+	}
+
+	usage.add("level thumbnails", textureCount * thumbnailSize.x * thumbnailSize.y * 4
+		+ entries.size() * (sizeof(std::pair<const Level *, Entry>) + MemoryUsage::NodeOverhead), textureCount);
+}
+
+void LevelThumbnailCache::startJob(const Level & level, Entry & entry)
+{
+	Job job;
+	job.id = ++nextJobID;
+	job.size = thumbnailSize;
+
+	for (auto it = level.tilesBegin(); it != level.tilesEnd(); ++it)
+	{
+		sf::Color color = tileAppearance == nullptr ? sf::Color::White : tileAppearance->getTileColor(it.getTile());
+
+		if (color.a != 0)
+		{
+			job.tiles.push_back({ *it, color });
+		}
+	}
+
+	entry.isOutdated = false;
+	entry.pendingJobID = job.id;
+	entry.refreshClock.restart();
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		jobs.push_back(std::move(job));
+
+		if (!worker.joinable())
+		{
+			worker = std::thread(&LevelThumbnailCache::runWorker, this);
+		}
+	}
+
+	condition.notify_one();
+}
+
+void LevelThumbnailCache::runWorker()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+
+	while (true)
+	{
+		condition.wait(lock, [this]()
+		{
+			return isStopping || !jobs.empty();
+		});
+
+		if (isStopping)
+		{
+			return;
+		}
+
+		Job job = std::move(jobs.front());
+		jobs.pop_front();
+
+		lock.unlock();
+		Result result = { job.id, generatePixels(job) };
+		lock.lock();
+
+		results.push_back(std::move(result));
+	}
+}
+
+void LevelThumbnailCache::stopWorker()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isStopping = true;
+		jobs.clear();
+	}
+
+	condition.notify_all();
+
+	if (worker.joinable())
+	{
+		worker.join();
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	results.clear();
+	isStopping = false;
+}
+
+std::vector<sf::Uint8> LevelThumbnailCache::generatePixels(const Job & job)
+{
+	ProfileZone zone("LevelThumbnailCache::generatePixels");
+
+	std::vector<sf::Uint8> pixels(job.size.x * job.size.y * 4, 0);
+
+	if (job.tiles.empty() || job.size.x == 0 || job.size.y == 0)
+	{
+		return pixels;
+	}
+
+	sf::Vector2i topLeft(std::numeric_limits<int>::max(), std::numeric_limits<int>::max());
+	sf::Vector2i bottomRight(std::numeric_limits<int>::min(), std::numeric_limits<int>::min());
+
+	for (const TileSample & tile : job.tiles)
+	{
+		topLeft.x = std::min(topLeft.x, tile.position.x);
+		topLeft.y = std::min(topLeft.y, tile.position.y);
+		bottomRight.x = std::max(bottomRight.x, tile.position.x);
+		bottomRight.y = std::max(bottomRight.y, tile.position.y);
+	}
+
+	sf::Vector2f tileCount(bottomRight.x - topLeft.x + 1, bottomRight.y - topLeft.y + 1);
+	float scale = std::min(MAX_PIXELS_PER_TILE, std::min(job.size.x / tileCount.x, job.size.y / tileCount.y));
+
+	// Center the level within the thumbnail.
+	sf::Vector2f offset((job.size.x - tileCount.x * scale) / 2.f, (job.size.y - tileCount.y * scale) / 2.f);
+
+	// Sum up the colors of all tiles covering each pixel.
+	std::vector<sf::Uint32> sums(job.size.x * job.size.y * 5, 0);
+
+	for (const TileSample & tile : job.tiles)
+	{
+		float left = offset.x + (tile.position.x - topLeft.x) * scale;
+		float top = offset.y + (tile.position.y - topLeft.y) * scale;
+
+		unsigned int x0 = std::min<unsigned int>(left, job.size.x - 1);
+		unsigned int y0 = std::min<unsigned int>(top, job.size.y - 1);
+		unsigned int x1 = std::max(x0 + 1, std::min<unsigned int>(left + scale, job.size.x));
+		unsigned int y1 = std::max(y0 + 1, std::min<unsigned int>(top + scale, job.size.y));
+
+		for (unsigned int y = y0; y < y1; ++y)
+		{
+			for (unsigned int x = x0; x < x1; ++x)
+			{
+				sf::Uint32 * sum = &sums[(y * job.size.x + x) * 5];
+				sum[0] += tile.color.r;
+				sum[1] += tile.color.g;
+				sum[2] += tile.color.b;
+				sum[3] += tile.color.a;
+				sum[4]++;
+			}
+		}
+	}
+
+	for (std::size_t i = 0; i < job.size.x * job.size.y; ++i)
+	{
+		const sf::Uint32 * sum = &sums[i * 5];
+
+		if (sum[4] != 0)
+		{
+			for (std::size_t channel = 0; channel < 4; ++channel)
+			{
+				pixels[i * 4 + channel] = sum[channel] / sum[4];
+			}
+		}
+	}
+
+	return pixels;
+}
@@ -0,0 +1,169 @@
+#ifndef SRC_CLIENT_EDITOR_LEVELTHUMBNAILCACHE_HPP_
+#define SRC_CLIENT_EDITOR_LEVELTHUMBNAILCACHE_HPP_
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <Shared/Level/Level.hpp>
+#include <Shared/Utils/Event/EventListener.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class Dungeon;
+class MemoryUsage;
+class TileAppearanceManager;
+
+/**
+ * Generates and caches small preview images of levels.
+ * 
+ * Thumbnails show one averaged color per tile, downsampled to fit the thumbnail size. The tiles of a level are copied
+ * on the calling thread, and the image is generated on a background thread, so requesting thumbnails for many or large
+ * levels does not stall the GUI.
+ * 
+ * Each cached thumbnail listens to its level's events and is regenerated when tiles change, at most once per refresh
+ * delay. The previous thumbnail stays available while a new one is generated.
+ */
+class LevelThumbnailCache
+{
+public:
+
+	LevelThumbnailCache();
+	~LevelThumbnailCache();
+
+	/**
+	 * Sets the appearance manager used to determine tile colors. Clears all thumbnails.
+	 */
+	void setTileAppearance(const TileAppearanceManager * tileAppearance);
+	const TileAppearanceManager * getTileAppearance() const;
+
+	/**
+	 * Sets the size of generated thumbnails in pixels. Clears all thumbnails.
+	 */
+	void setThumbnailSize(sf::Vector2u size);
+	sf::Vector2u getThumbnailSize() const;
+
+	/**
+	 * Sets the minimum time between two regenerations of the same level's thumbnail.
+	 */
+	void setRefreshDelay(sf::Time delay);
+	sf::Time getRefreshDelay() const;
+
+	/**
+	 * Returns the thumbnail of the specified level, requesting its generation if it is not cached yet.
+	 * 
+	 * Returns a null pointer if no thumbnail of the level has been generated yet. The returned texture remains valid
+	 * until the level's thumbnail is removed from the cache.
+	 */
+	const sf::Texture * getThumbnail(const Level & level);
+
+	/**
+	 * Removes the thumbnails of all levels that are not part of the specified dungeon.
+	 */
+	void removeUnusedThumbnails(const Dungeon & dungeon);
+
+	/**
+	 * Removes all thumbnails.
+	 */
+	void clear();
+
+	/**
+	 * Checks cached levels for changes, starts generating outdated thumbnails and uploads finished thumbnails to their
+	 * textures. Has to be called regularly from the thread owning the levels and the graphics context.
+	 * 
+	 * Returns true if the contents of any thumbnail texture have changed.
+	 */
+	bool update();
+
+	/**
+	 * Returns true while thumbnails are being generated or waiting for their refresh delay, so update() still has
+	 * work to do.
+	 */
+	bool isUpdatePending() const;
+
+	/**
+	 * Adds the estimated memory used by the cached thumbnails to the specified object.
+	 */
+	void getMemoryUsage(MemoryUsage & usage) const;
+
+private:
+
+	/**
+	 * A tile as copied from a level for thumbnail generation.
+	 */
+	struct TileSample
+	{
+		sf::Vector2i position;
+		sf::Color color;
+	};
+
+	struct Job
+	{
+		std::size_t id;
+		sf::Vector2u size;
+		std::vector<TileSample> tiles;
+	};
+
+	struct Result
+	{
+		std::size_t jobID;
+		std::vector<sf::Uint8> pixels;
+	};
+
+	struct Entry
+	{
+		EventListener<Level::Event> listener;
+		std::unique_ptr<sf::Texture> texture;
+		bool isOutdated;
+
+		/**
+		 * ID of the job generating this thumbnail, or 0 if no job is running.
+		 */
+		std::size_t pendingJobID;
+
+		sf::Clock refreshClock;
+	};
+
+	/**
+	 * Copies the tiles of a level and queues a job to generate its thumbnail.
+	 */
+	void startJob(const Level & level, Entry & entry);
+
+	/**
+	 * Runs on the worker thread, processing queued jobs until the cache is destroyed.
+	 */
+	void runWorker();
+
+	/**
+	 * Stops the worker thread and discards all queued jobs and results.
+	 */
+	void stopWorker();
+
+	/**
+	 * Downsamples a tile list to an RGBA pixel array of the specified size.
+	 */
+	static std::vector<sf::Uint8> generatePixels(const Job & job);
+
+	const TileAppearanceManager * tileAppearance;
+	sf::Vector2u thumbnailSize;
+	sf::Time refreshDelay;
+
+	std::map<const Level *, Entry> entries;
+	std::size_t nextJobID;
+
+	std::thread worker;
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::deque<Job> jobs;
+	std::vector<Result> results;
+	bool isStopping;
+};
+
+#endif
@@ -33,6 +33,12 @@ Object* ObjectPropertyPanel::getObject() const
 	return object;
 }
 
+bool ObjectPropertyPanel::isSkippingIdleWidgets() const
+{
+	// Property widgets only change on input, so idle frames do not need to process them.
+	return true;
+}
+
 static constexpr float PROPERTY_ENTRY_HEIGHT = 24.f;
 static constexpr float PROPERTY_NAME_LABEL_WIDTH = 75.f;
 
@@ -50,19 +56,23 @@ void ObjectPropertyPanel::update()
 	// Null object means empty panel.
 	if (object != nullptr)
 	{
-		// Get object properties.
-		auto objectPropertyMap = object->getAllProperties();
-
 		// Iterate over object properties for widget generation.
-		for (const auto & objectProperty : objectPropertyMap)
+		for (std::size_t i = 0; i < std::size_t(Object::Property::Count); ++i)
 		{
+			Object::Property objectProperty = Object::Property(i);
+
+			if (!object->hasProperty(objectProperty))
+			{
+				continue;
+			}
+
 			// Generate entry from property key (and object type).
-			gui2::Ptr<PropertyEntry> entry = generatePropertyEntry(objectProperty.first, object->getType());
+			gui2::Ptr<PropertyEntry> entry = generatePropertyEntry(objectProperty, object->getType());
 
 			// Null entry is returned in case of invalid property key or hidden property.
 			if (entry != nullptr)
 			{
-				propertyMap[objectProperty.first] = entry;
+				propertyMap[objectProperty] = entry;
 			}
 		}
 
@@ -33,6 +33,8 @@ public:
 	void update();
 	void updateValues();
 
+	bool isSkippingIdleWidgets() const override;
+
 protected:
 
 	virtual void init() override;
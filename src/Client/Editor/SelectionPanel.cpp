@@ -6,6 +6,7 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Transform.hpp>
 #include <SFML/Window/Mouse.hpp>
+#include <Shared/Utils/Profiler.hpp>
 #include <Shared/Utils/Utilities.hpp>
 #include <algorithm>
 #include <memory>
@@ -40,6 +41,9 @@ SelectionPanel::SelectionPanel() :
 	hoveredItem(0),
 	itemCount(0),
 	itemSize(24.f, 24.f),
+	filterEnabled(false),
+	vertexRows(0, 0),
+	verticesInvalid(true),
 	scrollVelocity(0)
 {
 }
@@ -87,9 +91,33 @@ void SelectionPanel::setMapper(Mapper mapper, std::size_t itemCount)
 {
 	this->mapper = mapper;
 	this->itemCount = itemCount;
+
+	// Drop filtered items that no longer exist.
+	filteredItems.erase(std::lower_bound(filteredItems.begin(), filteredItems.end(), itemCount), filteredItems.end());
+
+	update();
+}
+
+void SelectionPanel::setFilter(std::vector<ID> items)
+{
+	filteredItems = std::move(items);
+	filteredItems.erase(std::lower_bound(filteredItems.begin(), filteredItems.end(), itemCount), filteredItems.end());
+	filterEnabled = true;
+	update();
+}
+
+void SelectionPanel::clearFilter()
+{
+	filteredItems.clear();
+	filterEnabled = false;
 	update();
 }
 
+bool SelectionPanel::isFiltered() const
+{
+	return filterEnabled;
+}
+
 std::size_t SelectionPanel::getItemCount() const
 {
 	return itemCount;
@@ -130,16 +158,7 @@ void SelectionPanel::update()
 		slider->setValue(0);
 	}
 
-	vertices.clear();
-
-	std::vector<sf::Vertex> itemVertices;
-
-	for (ID i = 0; i < getItemCount(); ++i)
-	{
-		itemVertices = mapper(i).vertices;
-		fitVerticesToRectangle(itemVertices, getItemRect(i));
-		vertices.insert(vertices.end(), itemVertices.begin(), itemVertices.end());
-	}
+	verticesInvalid = true;
 }
 
 bool SelectionPanel::wasChanged()
@@ -157,6 +176,12 @@ bool SelectionPanel::isVertexRenderable() const
 	return false;
 }
 
+bool SelectionPanel::isDrawnInsideRect() const
+{
+	// All drawing is clipped to the panel.
+	return true;
+}
+
 void SelectionPanel::onProcess(const gui2::WidgetEvents& events)
 {
 	if (slider->isEnabled())
@@ -199,6 +224,8 @@ void SelectionPanel::onProcess(const gui2::WidgetEvents& events)
 
 void SelectionPanel::onDraw(sf::RenderTarget& target, sf::RenderStates states) const
 {
+	updateVisibleVertices();
+
 	states.transform *= getTransform();
 
 	sf::Transform origTransform = states.transform;
@@ -210,13 +237,21 @@ void SelectionPanel::onDraw(sf::RenderTarget& target, sf::RenderStates states) c
 	{
 		drawClipped(VertexWrapper(&vertices[0], vertices.size(), sf::Triangles), target, states,
 			origTransform.transformRect(getBaseRect()));
+		Profiler::count("GUI draw calls", 1);
 	}
 
 	if (hasSelection())
 	{
 		states.texture = nullptr;
 
-		sf::FloatRect selectRect = getItemRect(getSelection());
+		std::pair<bool, std::size_t> selectIndex = getDisplayIndex(getSelection());
+
+		if (!selectIndex.first)
+		{
+			return;
+		}
+
+		sf::FloatRect selectRect = getItemRect(selectIndex.second);
 		sf::RectangleShape selectBox;
 		selectBox.setPosition(sf::Vector2f(selectRect.left, selectRect.top));
 		selectBox.setSize(sf::Vector2f(selectRect.width, selectRect.height));
@@ -224,6 +259,7 @@ void SelectionPanel::onDraw(sf::RenderTarget& target, sf::RenderStates states) c
 		selectBox.setOutlineColor(sf::Color(255, 255, 255, 220));
 		selectBox.setOutlineThickness(2.f);
 		drawClipped(selectBox, target, states, origTransform.transformRect(getBaseRect()));
+		Profiler::count("GUI draw calls", 1);
 	}
 }
 
@@ -234,7 +270,7 @@ void SelectionPanel::onResize()
 
 std::size_t SelectionPanel::getRowCount() const
 {
-	return (getItemCount() + getColumnCount() - 1) / getColumnCount();
+	return (getDisplayedItemCount() + getColumnCount() - 1) / getColumnCount();
 }
 
 std::size_t SelectionPanel::getColumnCount() const
@@ -242,6 +278,71 @@ std::size_t SelectionPanel::getColumnCount() const
 	return std::max<std::size_t>(1, (getSize().x - MARGIN - SLIDER_WIDTH) / (getItemSize().x + MARGIN));
 }
 
+std::size_t SelectionPanel::getDisplayedItemCount() const
+{
+	return filterEnabled ? filteredItems.size() : getItemCount();
+}
+
+SelectionPanel::ID SelectionPanel::getDisplayedItem(std::size_t index) const
+{
+	return filterEnabled ? filteredItems[index] : index;
+}
+
+std::pair<bool, std::size_t> SelectionPanel::getDisplayIndex(ID item) const
+{
+	if (!filterEnabled)
+	{
+		return std::make_pair(item < getItemCount(), item);
+	}
+
+	auto it = std::lower_bound(filteredItems.begin(), filteredItems.end(), item);
+
+	if (it == filteredItems.end() || *it != item)
+	{
+		return std::make_pair(false, 0);
+	}
+
+	return std::make_pair(true, it - filteredItems.begin());
+}
+
+std::pair<std::size_t, std::size_t> SelectionPanel::getVisibleRows() const
+{
+	float rowHeight = getItemSize().y + MARGIN;
+	float top = std::max(0.f, slider->getValue() - MARGIN);
+
+	std::size_t rowCount = getRowCount();
+	std::size_t begin = std::min<std::size_t>(rowCount, top / rowHeight);
+	std::size_t end = std::min<std::size_t>(rowCount, std::ceil((top + getSize().y) / rowHeight));
+
+	return std::make_pair(begin, std::max(begin, end));
+}
+
+void SelectionPanel::updateVisibleVertices() const
+{
+	std::pair<std::size_t, std::size_t> rows = getVisibleRows();
+
+	if (!verticesInvalid && rows == vertexRows)
+	{
+		return;
+	}
+
+	vertices.clear();
+
+	std::size_t indexBegin = rows.first * getColumnCount();
+	std::size_t indexEnd = std::min(getDisplayedItemCount(), rows.second * getColumnCount());
+
+	for (std::size_t i = indexBegin; i < indexEnd; ++i)
+	{
+		const std::vector<sf::Vertex> & itemVertices = mapper(getDisplayedItem(i)).vertices;
+		std::size_t offset = vertices.size();
+		vertices.insert(vertices.end(), itemVertices.begin(), itemVertices.end());
+		fitVerticesToRectangle(vertices.data() + offset, itemVertices.size(), getItemRect(i));
+	}
+
+	vertexRows = rows;
+	verticesInvalid = false;
+}
+
 void SelectionPanel::setTexture(const sf::Texture* texture)
 {
 	this->texture = texture;
@@ -266,10 +367,10 @@ void SelectionPanel::onMouseDown(sf::Vector2f pos, Input button)
 	}
 }
 
-sf::FloatRect SelectionPanel::getItemRect(ID item) const
+sf::FloatRect SelectionPanel::getItemRect(std::size_t index) const
 {
-	std::size_t indexX = item % getColumnCount();
-	std::size_t indexY = item / getColumnCount();
+	std::size_t indexX = index % getColumnCount();
+	std::size_t indexY = index / getColumnCount();
 
 	sf::FloatRect rect(indexX * (getItemSize().x + MARGIN) + MARGIN, indexY * (getItemSize().y + MARGIN) + MARGIN,
 		getItemSize().x, getItemSize().y);
@@ -277,30 +378,31 @@ sf::FloatRect SelectionPanel::getItemRect(ID item) const
 	return rect;
 }
 
-sf::FloatRect SelectionPanel::getShiftedItemRect(ID item) const
+std::pair<bool, SelectionPanel::ID> SelectionPanel::getItemAtPosition(sf::Vector2f pos) const
 {
-	return moveRect(getItemRect(item), sf::Vector2f(0, -slider->getValue()));
-}
+	// Clickable item rectangles tile the grid without gaps, so the cell can be computed directly.
+	sf::Vector2f cellSize = getItemSize() + sf::Vector2f(MARGIN, MARGIN);
+	sf::Vector2f gridPos = pos + sf::Vector2f(-MARGIN / 2, slider->getValue() - MARGIN / 2);
 
-sf::FloatRect SelectionPanel::getClickableItemRect(ID item) const
-{
-	return expandRect(getShiftedItemRect(item), sf::Vector2f(MARGIN / 2, MARGIN / 2));
-}
+	if (gridPos.x < 0 || gridPos.y < 0)
+	{
+		return std::make_pair(false, 0);
+	}
 
-std::pair<bool, SelectionPanel::ID> SelectionPanel::getItemAtPosition(sf::Vector2f pos) const
-{
-	// Optimization.
-	if (hasHoveredItem() && getClickableItemRect(getHoveredItem()).contains(pos))
+	std::size_t column = gridPos.x / cellSize.x;
+	std::size_t row = gridPos.y / cellSize.y;
+
+	if (column >= getColumnCount() || row >= getRowCount())
 	{
-		return std::make_pair(true, getHoveredItem());
+		return std::make_pair(false, 0);
 	}
 
-	for (ID i = 0; i < getItemCount(); ++i)
+	std::size_t index = row * getColumnCount() + column;
+
+	if (index >= getDisplayedItemCount())
 	{
-		if (getClickableItemRect(i).contains(pos))
-		{
-			return std::make_pair(true, i);
-		}
+		return std::make_pair(false, 0);
 	}
-	return std::make_pair(false, 0);
+
+	return std::make_pair(true, getDisplayedItem(index));
 }
@@ -59,12 +59,24 @@ public:
 	const Mapper & getMapper() const;
 	std::size_t getItemCount() const;
 
+	/**
+	 * Only displays the specified items, which must be sorted in ascending order. Selection and hover state keep
+	 * referring to the unfiltered item IDs.
+	 */
+	void setFilter(std::vector<ID> items);
+	void clearFilter();
+	bool isFiltered() const;
+
 	void setItemSize(sf::Vector2f itemSize);
 	sf::Vector2f getItemSize() const;
 
 	void setTexture(const sf::Texture * texture);
 	const sf::Texture * getTexture() const;
 
+	/**
+	 * Recomputes the grid layout. Item vertices are generated lazily, only for the rows visible at the current
+	 * scroll position.
+	 */
 	void update();
 
 	bool wasChanged();
@@ -72,6 +84,7 @@ public:
 	SelectionPanel();
 
 	bool isVertexRenderable() const override;
+	bool isDrawnInsideRect() const override;
 
 protected:
 
@@ -88,9 +101,28 @@ private:
 	std::size_t getRowCount() const;
 	std::size_t getColumnCount() const;
 
-	sf::FloatRect getItemRect(ID item) const;
-	sf::FloatRect getShiftedItemRect(ID item) const;
-	sf::FloatRect getClickableItemRect(ID item) const;
+	/**
+	 * Returns the number of items passing the filter, and the item displayed at a grid position.
+	 */
+	std::size_t getDisplayedItemCount() const;
+	ID getDisplayedItem(std::size_t index) const;
+
+	/**
+	 * Returns the grid position of an item, if it passes the filter.
+	 */
+	std::pair<bool, std::size_t> getDisplayIndex(ID item) const;
+
+	/**
+	 * Returns the range of rows that is at least partially visible at the current slider offset.
+	 */
+	std::pair<std::size_t, std::size_t> getVisibleRows() const;
+
+	/**
+	 * Regenerates the vertices if the visible rows changed since the last call.
+	 */
+	void updateVisibleVertices() const;
+
+	sf::FloatRect getItemRect(std::size_t index) const;
 	std::pair<bool, ID> getItemAtPosition(sf::Vector2f pos) const;
 
 	Mapper mapper;
@@ -105,7 +137,13 @@ private:
 	std::size_t itemCount;
 	sf::Vector2f itemSize;
 
-	std::vector<sf::Vertex> vertices;
+	bool filterEnabled;
+	std::vector<ID> filteredItems;
+
+	// vertices of the visible rows only. generated on demand while drawing.
+	mutable std::vector<sf::Vertex> vertices;
+	mutable std::pair<std::size_t, std::size_t> vertexRows;
+	mutable bool verticesInvalid;
 
 	gui2::Ptr<gui2::Slider> slider;
 	float scrollVelocity;
@@ -84,10 +84,24 @@ void ObjectToolPanel::init()
 	selectionPanel->setTexture(objectAppearance->getTexture());
 	selectionPanel->setMapper(mapperFactory.generateObjectMapper(this->objects), this->objects.size());
 
+	// Index object names once, so filtering the palette does not touch appearance data.
+	std::vector<std::string> objectNames;
+	objectNames.reserve(objects.size());
+
+	for (const Object & object : objects)
+	{
+		objectNames.push_back(objectAppearance->getObjectName(object));
+	}
+
+	objectNameIndex.setNames(objectNames);
+
+	searchField = gui2::TextField::make();
+
 	propertyPanel = ObjectPropertyPanel::make();
 
 	auto borderPanel = gui2::BorderPanel::make();
 
+	borderPanel->add(searchField, gui2::BorderPanel::Top, 20);
 	borderPanel->add(selectionPanel, gui2::BorderPanel::Center);
 	borderPanel->add(propertyPanel, gui2::BorderPanel::Bottom);
 	borderPanel->add(modePanel, gui2::BorderPanel::Bottom, 50);
@@ -97,6 +111,11 @@ void ObjectToolPanel::init()
 
 void ObjectToolPanel::onProcessContainer(gui2::WidgetEvents& events)
 {
+	if (searchField->wasChanged())
+	{
+		updateFilter();
+	}
+
 	if (selectionPanel->wasChanged())
 	{
 		if (selectionPanel->hasSelection())
@@ -142,3 +161,16 @@ void ObjectToolPanel::addDefaultPropertiesToObject()
 		}
 	}
 }
+
+void ObjectToolPanel::updateFilter()
+{
+	if (searchField->getText().empty())
+	{
+		selectionPanel->clearFilter();
+	}
+	else
+	{
+		objectNameIndex.find(searchField->getText(), filteredObjects);
+		selectionPanel->setFilter(filteredObjects);
+	}
+}
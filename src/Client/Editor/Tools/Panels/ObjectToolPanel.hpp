@@ -5,9 +5,11 @@
 #include <Client/Editor/SelectionPanel.hpp>
 #include <Client/GUI2/GUI.hpp>
 #include <Client/GUI2/Widgets/Dropdown.hpp>
+#include <Client/GUI2/Widgets/TextField.hpp>
 #include <Client/LevelRenderer/ObjectAppearance.hpp>
 #include <Shared/Editor/Brush.hpp>
 #include <Shared/Level/Object.hpp>
+#include <Shared/Utils/SearchIndex.hpp>
 #include <vector>
 
 /**
@@ -53,14 +55,22 @@ private:
 
 	void addDefaultPropertiesToObject();
 
+	/**
+	 * Restricts the palette to the objects whose name contains the search text.
+	 */
+	void updateFilter();
+
 	const ObjectAppearanceManager * objectAppearance;
 
 	std::vector<Object> objects;
+	SearchIndex objectNameIndex;
+	std::vector<std::size_t> filteredObjects;
 	Object selectedObject;
 	Object hoveredObject;
 
 	gui2::Ptr<gui2::Dropdown> primaryModeMenu;
 	gui2::Ptr<gui2::Dropdown> secondaryModeMenu;
+	gui2::Ptr<gui2::TextField> searchField;
 	gui2::Ptr<SelectionPanel> selectionPanel;
 	gui2::Ptr<ObjectPropertyPanel> propertyPanel;
 };
@@ -63,6 +63,26 @@ void TileToolPanel::init()
 	wallPanel->setItemSize({24, 48});
 	selectorContainer->add(wallPanel);
 
+	// Tile names do not depend on the zone or tile flags, so the indices never need to be rebuilt.
+	std::vector<std::string> tileNames;
+
+	for (const Tile & tile : floors)
+	{
+		tileNames.push_back(tileAppearance->getTileName(tile));
+	}
+
+	floorNameIndex.setNames(tileNames);
+	tileNames.clear();
+
+	for (const Tile & tile : walls)
+	{
+		tileNames.push_back(tileAppearance->getTileName(tile));
+	}
+
+	wallNameIndex.setNames(tileNames);
+
+	searchField = gui2::TextField::make();
+
 	std::vector<std::string> zoneNames = { "Zone 1", "Zone 2", "Zone 3 Hot", "Zone 3 Cold", "Zone 4", "Boss", "Zone 5" };
 
 	auto zoneButtonContainer = gui2::GridPanel::make(2, (zoneNames.size() + 1) / 2);
@@ -90,6 +110,7 @@ void TileToolPanel::init()
 	tileCrackCheckbox->setText("Cracked");
 	checkboxContainer->add(tileCrackCheckbox);
 
+	add(searchField, gui2::BorderPanel::Top, 20.f);
 	add(selectorContainer, gui2::BorderPanel::Center);
 	add(zoneButtonContainer, gui2::BorderPanel::Bottom, 100.f);
 	add(checkboxContainer, gui2::BorderPanel::Bottom, 20.f);
@@ -161,8 +182,29 @@ void TileToolPanel::updateHoveredTile()
 	}
 }
 
+void TileToolPanel::updateFilter()
+{
+	if (searchField->getText().empty())
+	{
+		floorPanel->clearFilter();
+		wallPanel->clearFilter();
+	}
+	else
+	{
+		floorNameIndex.find(searchField->getText(), filteredTiles);
+		floorPanel->setFilter(filteredTiles);
+		wallNameIndex.find(searchField->getText(), filteredTiles);
+		wallPanel->setFilter(filteredTiles);
+	}
+}
+
 void TileToolPanel::onProcessContainer(gui2::WidgetEvents& events)
 {
+	if (searchField->wasChanged())
+	{
+		updateFilter();
+	}
+
 	if (floorPanel->wasChanged())
 	{
 		wallPanel->clearSelection();
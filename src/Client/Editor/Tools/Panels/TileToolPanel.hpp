@@ -6,8 +6,10 @@
 #include <Client/GUI2/Panels/BorderPanel.hpp>
 #include <Client/GUI2/Widgets/Button.hpp>
 #include <Client/GUI2/Widgets/Checkbox.hpp>
+#include <Client/GUI2/Widgets/TextField.hpp>
 #include <Client/LevelRenderer/TileAppearance.hpp>
 #include <Shared/Level/Tile.hpp>
+#include <Shared/Utils/SearchIndex.hpp>
 #include <vector>
 
 /**
@@ -44,16 +46,25 @@ private:
 	void updateSelectedTile();
 	void updateHoveredTile();
 
+	/**
+	 * Restricts both palettes to the tiles whose name contains the search text.
+	 */
+	void updateFilter();
+
 	void onProcessContainer(gui2::WidgetEvents & events) override;
 
 	const TileAppearanceManager * tileAppearance;
 
 	std::vector<Tile> floors;
 	std::vector<Tile> walls;
+	SearchIndex floorNameIndex;
+	SearchIndex wallNameIndex;
+	std::vector<std::size_t> filteredTiles;
 	Tile selectedTile;
 	Tile hoveredTile;
 	Tile baseTile;
 
+	gui2::Ptr<gui2::TextField> searchField;
 	gui2::Ptr<SelectionPanel> floorPanel;
 	gui2::Ptr<SelectionPanel> wallPanel;
 
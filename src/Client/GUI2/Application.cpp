@@ -1,10 +1,21 @@
 #include "Client/GUI2/Application.hpp"
+#include "Shared/Utils/Profiler.hpp"
+#include "Shared/Utils/Utilities.hpp"
+
+#include <SFML/System/Clock.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
 
 namespace gui2
 {
 
 Application::Application() :
-	myHasWhitePixel(false)
+	myHasWhitePixel(false),
+	myIsEventDriven(false),
+	myCpuUsage(0.f),
+	myIdleRatio(0.f),
+	myRunFrameCount(0)
 {
 	setFramerateLimit(70);
 	myTexturePacker.setSmooth(true);
@@ -25,17 +36,48 @@ int Application::run(const std::vector<std::string>& args)
 	}
 	else
 	{
+		sf::Clock frameClock;
+
+		myUsageClock.restart();
+		myRunClock.restart();
+		myUsageCpuTime = myRunCpuTime = getProcessCpuTime();
+
 		while (!myInterfaces.empty())
 		{
-			for (auto it = myInterfaces.begin(); it != myInterfaces.end(); )
+			if (myIsEventDriven)
+			{
+				waitForInput();
+			}
+
+			frameClock.restart();
+
 			{
-				if ((*it)->isWindowOpen())
+				ProfileZone zone("Application::frame");
+
+				for (auto it = myInterfaces.begin(); it != myInterfaces.end(); )
+				{
+					if ((*it)->isWindowOpen())
+					{
+						(*it)->process();
+						++it;
+					}
+					else
+						it = myInterfaces.erase(it);
+				}
+			}
+
+			std::shared_ptr<Interface> replayInterface = myReplayInterface.lock();
+
+			if (replayInterface)
+			{
+				myReplayFrameTimes.push_back(frameClock.getElapsedTime());
+
+				if (!replayInterface->isReplayingInput())
 				{
-					(*it)->process();
-					++it;
+					reportReplayTimings();
+					myReplayInterface.reset();
+					exit();
 				}
-				else
-					it = myInterfaces.erase(it);
 			}
 
 			// sleep if necessary.
@@ -43,9 +85,21 @@ int Application::run(const std::vector<std::string>& args)
 			{
 				myFramerateTimer.tick();
 			}
+
+			Profiler::nextFrame();
+
+			myRunFrameCount++;
+			updateUsageStatistics();
 		}
 	}
 
+	saveInputRecordings();
+
+	if (myIsEventDriven)
+	{
+		reportUsage();
+	}
+
 	return 0;
 }
 
@@ -94,6 +148,43 @@ int Application::getFramerateLimit() const
 	return myFramerateLimit;
 }
 
+void Application::setEventDrivenEnabled(bool enabled)
+{
+	myIsEventDriven = enabled;
+}
+
+bool Application::isEventDrivenEnabled() const
+{
+	return myIsEventDriven;
+}
+
+float Application::getCpuUsage() const
+{
+	return myCpuUsage;
+}
+
+float Application::getIdleRatio() const
+{
+	return myIdleRatio;
+}
+
+void Application::recordInput(std::shared_ptr<Interface> interface, const std::string & filename)
+{
+	std::shared_ptr<InputRecording> recording = std::make_shared<InputRecording>();
+	interface->setInputRecording(recording);
+	myInputRecordings.emplace_back(recording, filename);
+}
+
+void Application::replayInput(std::shared_ptr<Interface> interface, std::shared_ptr<const InputRecording> recording,
+		const std::string & timingFile)
+{
+	interface->setInputReplay(recording);
+	myReplayInterface = interface;
+	myReplayFrameTimes.clear();
+	myReplayTimingFile = timingFile;
+	setFramerateLimit(0);
+}
+
 std::shared_ptr<const btx::BitmapFont> Application::getFont(int index) const
 {
 	auto it = myFonts.find(index);
@@ -242,6 +333,150 @@ int Application::init(const std::vector<std::string>& args)
 	return 0;
 }
 
+void Application::saveInputRecordings()
+{
+	for (const auto & recording : myInputRecordings)
+	{
+		if (recording.first->saveToFile(recording.second))
+		{
+			std::printf("Recorded %zu frames of input to %s\n", recording.first->getFrameCount(),
+					recording.second.c_str());
+		}
+		else
+		{
+			std::fprintf(stderr, "Failed to save input recording to %s\n", recording.second.c_str());
+		}
+	}
+
+	myInputRecordings.clear();
+}
+
+void Application::reportReplayTimings()
+{
+	if (myReplayFrameTimes.empty())
+	{
+		return;
+	}
+
+	sf::Time total;
+	for (sf::Time time : myReplayFrameTimes)
+	{
+		total += time;
+	}
+
+	std::vector<sf::Time> sorted = myReplayFrameTimes;
+	std::sort(sorted.begin(), sorted.end());
+
+	auto percentile = [&](float fraction)
+	{
+		return sorted[std::min<std::size_t>(sorted.size() * fraction, sorted.size() - 1)].asSeconds() * 1000.f;
+	};
+
+	std::printf("Replayed %zu frames in %.3f s (%.1f fps)\n", sorted.size(), total.asSeconds(),
+			sorted.size() / std::max(total.asSeconds(), 0.000001f));
+	std::printf("Frame time: %.3f ms avg, %.3f ms median, %.3f ms p95, %.3f ms p99, %.3f ms max\n",
+			total.asSeconds() * 1000.f / sorted.size(), percentile(0.5f), percentile(0.95f), percentile(0.99f),
+			sorted.back().asSeconds() * 1000.f);
+
+	if (!myReplayTimingFile.empty())
+	{
+		std::ofstream file(myReplayTimingFile);
+		file << "frame,milliseconds\n";
+
+		for (std::size_t i = 0; i < myReplayFrameTimes.size(); ++i)
+		{
+			file << i << "," << myReplayFrameTimes[i].asMicroseconds() / 1000.0 << "\n";
+		}
+
+		if (!file)
+		{
+			std::fprintf(stderr, "Failed to write frame timings to %s\n", myReplayTimingFile.c_str());
+		}
+	}
+}
+
+void Application::waitForInput()
+{
+	for (const auto & interface : myInterfaces)
+	{
+		if (!interface->isIdle() || !interface->isWindowOpen())
+		{
+			return;
+		}
+	}
+
+	ProfileZone zone("Application::wait");
+	sf::Clock waitClock;
+
+	// stop waiting when the earliest timed update is due.
+	bool hasTimeout = false;
+	sf::Time timeout;
+
+	for (const auto & interface : myInterfaces)
+	{
+		if (interface->hasTimedUpdate() && (!hasTimeout || interface->getTimeUntilUpdate() < timeout))
+		{
+			timeout = interface->getTimeUntilUpdate();
+			hasTimeout = true;
+		}
+	}
+
+	if (myInterfaces.size() == 1 && !hasTimeout)
+	{
+		myInterfaces.front()->waitEvent(true);
+	}
+	else
+	{
+		// blocking on one window would ignore the others and the timeout, so poll all of them at the framerate limit.
+		sf::Time pollInterval = getFramerateLimit() > 0 ? sf::microseconds(1000000 / getFramerateLimit())
+			: sf::milliseconds(10);
+
+		while (std::none_of(myInterfaces.begin(), myInterfaces.end(),
+				[](const std::shared_ptr<Interface> & interface) { return interface->waitEvent(false); }))
+		{
+			sf::Time elapsed = waitClock.getElapsedTime();
+
+			if (hasTimeout && elapsed >= timeout)
+			{
+				break;
+			}
+
+			sf::sleep(hasTimeout ? std::min(pollInterval, timeout - elapsed) : pollInterval);
+		}
+	}
+
+	myUsageIdleTime += waitClock.getElapsedTime();
+	myRunIdleTime += waitClock.getElapsedTime();
+}
+
+void Application::updateUsageStatistics()
+{
+	sf::Time elapsed = myUsageClock.getElapsedTime();
+
+	if (elapsed < sf::seconds(1.f))
+	{
+		return;
+	}
+
+	sf::Time cpuTime = getProcessCpuTime();
+
+	myCpuUsage = (cpuTime - myUsageCpuTime).asSeconds() / elapsed.asSeconds();
+	myIdleRatio = myUsageIdleTime.asSeconds() / elapsed.asSeconds();
+
+	myUsageClock.restart();
+	myUsageCpuTime = cpuTime;
+	myUsageIdleTime = sf::Time::Zero;
+}
+
+void Application::reportUsage()
+{
+	float seconds = std::max(myRunClock.getElapsedTime().asSeconds(), 0.000001f);
+
+	std::printf("Rendered %zu frames in %.1f s (%.1f fps), idle %.1f%% of the time, %.1f%% CPU usage\n",
+			myRunFrameCount, seconds, myRunFrameCount / seconds, myRunIdleTime.asSeconds() * 100.f / seconds,
+			(getProcessCpuTime() - myRunCpuTime).asSeconds() * 100.f / seconds);
+}
+
 std::shared_ptr<Interface> Application::makeInterface()
 {
 	return std::make_shared<Interface>();
@@ -46,6 +46,34 @@ public:
 	/// returns the application's framerate limit. (0 = unlimited, -1 = vsync)
 	int getFramerateLimit() const;
 
+	/// enables/disables event-driven rendering. when enabled, frames are only
+	/// processed and rendered while an interface receives input, changes a
+	/// widget or has an update requested. otherwise, the application waits for
+	/// the next window event without using the CPU. (default: disabled)
+	void setEventDrivenEnabled(bool enabled);
+
+	/// returns true if event-driven rendering is enabled.
+	bool isEventDrivenEnabled() const;
+
+	/// returns the fraction of a CPU core used by the application's process
+	/// during the last second.
+	float getCpuUsage() const;
+
+	/// returns the fraction of the last second the application spent waiting
+	/// for input in event-driven mode.
+	float getIdleRatio() const;
+
+	/// records the input of an interface until the application stops, then
+	/// saves the recording to the specified file.
+	void recordInput(std::shared_ptr<Interface> interface, const std::string & filename);
+
+	/// replays an input recording on an interface at unlimited framerate.
+	/// once the last frame has been processed, prints frame timings to
+	/// standard output, writes the duration of each frame to timingFile (as
+	/// CSV, if not empty) and exits.
+	void replayInput(std::shared_ptr<Interface> interface, std::shared_ptr<const InputRecording> recording,
+			const std::string & timingFile = "");
+
 	/// returns one of the application's loaded fonts.
 	std::shared_ptr<const btx::BitmapFont> getFont(int index = FontDefault) const;
 
@@ -99,6 +127,21 @@ private:
 	// called to unify image names into identifiers.
 	virtual bool convertImageName(std::string & imageName);
 
+	// saves all input recordings to their files.
+	void saveInputRecordings();
+
+	// prints the frame timings of a finished input replay.
+	void reportReplayTimings();
+
+	// blocks until an interface receives an event, if all interfaces are idle.
+	void waitForInput();
+
+	// recomputes CPU usage and idle ratio once per second.
+	void updateUsageStatistics();
+
+	// prints the frame count, idle ratio and CPU usage of the whole run.
+	void reportUsage();
+
 	// holds a list of all open interfaces.
 	std::vector<std::shared_ptr<Interface> > myInterfaces;
 
@@ -122,6 +165,30 @@ private:
 
 	// the application's framerate limit.
 	int myFramerateLimit;
+
+	// true if frames are only produced when something changes.
+	bool myIsEventDriven;
+
+	// usage statistics of the current second, and the results of the last one.
+	sf::Clock myUsageClock;
+	sf::Time myUsageCpuTime;
+	sf::Time myUsageIdleTime;
+	float myCpuUsage;
+	float myIdleRatio;
+
+	// usage statistics since the application started running.
+	sf::Clock myRunClock;
+	sf::Time myRunCpuTime;
+	sf::Time myRunIdleTime;
+	std::size_t myRunFrameCount;
+
+	// input recordings and the files they are saved to when the application stops.
+	std::vector<std::pair<std::shared_ptr<InputRecording>, std::string> > myInputRecordings;
+
+	// interface that is replaying input, if any, and the durations of the frames replayed so far.
+	std::weak_ptr<Interface> myReplayInterface;
+	std::vector<sf::Time> myReplayFrameTimes;
+	std::string myReplayTimingFile;
 };
 
 } // namespace gui2
@@ -1,12 +1,100 @@
 #include "Client/GUI2/Application.hpp"
 #include "Client/Graphics/UtilitiesSf.hpp"
+#include "Shared/Utils/MakeUnique.hpp"
+#include "Shared/Utils/MemoryUsage.hpp"
+#include "Shared/Utils/Profiler.hpp"
 #include "Shared/Utils/Utilities.hpp"
 
+#include <SFML/Graphics/Sprite.hpp>
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 
 namespace gui2
 {
 
+namespace containerPriv
+{
+
+// holds the widgets of all containers that are currently being processed, so
+// each container can iterate over a stable copy of its widget list without
+// allocating memory every frame. nested containers append their widgets
+// behind those of their parents and remove them when they are done.
+std::vector<std::shared_ptr<Widget> > & getProcessArena()
+{
+	static std::vector<std::shared_ptr<Widget> > arena;
+	return arena;
+}
+
+// widgets whose drawing is postponed until the containers drawing them have
+// drawn their vertex caches. each container only uses the entries it added.
+std::vector<const Widget *> & getDeferredWidgets()
+{
+	static std::vector<const Widget *> widgets;
+	return widgets;
+}
+
+// holds the widgets' mouseover rectangles while a container builds its hit
+// grid, and the indices found by the hit grid.
+std::vector<sf::FloatRect> & getHitRects()
+{
+	static std::vector<sf::FloatRect> rects;
+	return rects;
+}
+
+std::vector<std::size_t> & getHitResults()
+{
+	static std::vector<std::size_t> results;
+	return results;
+}
+
+// holds clipped widget vertices while a container updates its vertex cache.
+std::vector<sf::Vertex> & getClipBuffer()
+{
+	static std::vector<sf::Vertex> buffer;
+	return buffer;
+}
+
+// holds the vertex cache of the last container that rebuilt its ranges.
+std::vector<sf::Vertex> & getRebuildBuffer()
+{
+	static std::vector<sf::Vertex> buffer;
+	return buffer;
+}
+
+void appendTransformed(std::vector<sf::Vertex> & output, const std::vector<sf::Vertex> & vertices,
+		const sf::Transform & transform)
+{
+	for (const sf::Vertex & vertex : vertices)
+	{
+		output.push_back(vertex);
+		output.back().position = transform.transformPoint(vertex.position);
+	}
+}
+
+// returns the size of a vertex range that has to hold the specified number
+// of vertices. ranges are placed tightly at first. ranges that grow get
+// slack, so widgets with changing vertex counts (text fields, lists) rarely
+// need the cache to be rebuilt. mostly empty ranges are shrunk again.
+std::size_t getRangeCapacity(std::size_t capacity, std::size_t count)
+{
+	if (capacity == 0 || (count <= capacity && capacity <= count * 2 + 48))
+	{
+		return std::max(capacity, count);
+	}
+
+	// keep capacities a multiple of 3, so ranges only hold whole triangles.
+	return count + count / 6 * 3;
+}
+
+bool hasInputEvents(const ContainerEvents & events)
+{
+	return !events.mouseEvents.empty() || !events.keyEvents.empty() || !events.textInput.empty()
+		|| events.mouseWheelDelta != 0;
+}
+
+}
+
 Ptr<Container> Container::make()
 {
 	Ptr<Container> widget = std::make_shared<Container>();
@@ -19,7 +107,13 @@ void Container::init()
 	myIsVertexRenderable = true;
 	myAllVerticesInvalid = true;
 	myVertexCountPrepend = 0;
+	myVertexCapacityPrepend = 0;
 	myVertexCountAppend = 0;
+	myIsRenderCacheEnabled = false;
+	myIsRenderCacheInvalid = true;
+	myIsHitGridInvalid = true;
+	myHitTestIndex = 0;
+	myHasPendingWidgets = true;
 }
 
 Container::~Container()
@@ -46,18 +140,18 @@ void Container::remove(std::shared_ptr<Widget> widget)
 			remove(lWidget);
 		}
 
-		auto it = myWidgetIndexMap.find(widget);
-		if (it == myWidgetIndexMap.end())
-			return;
-
 		onRemove(widget);
 
+		std::size_t widgetIndex = getWidgetIndex(widget.get());
+		if (widgetIndex == myWidgets.size())
+			return;
+
 		// the widget's info struct and vertices are moved to the back.
 		// the info is removed immediately, the vertices are cleaned up
 		// on the next call to onUpdateVertexCache().
-		moveWidget(it->second, myWidgets.size() - 1);
+		moveWidget(widgetIndex, myWidgets.size() - 1);
 		myWidgets.pop_back();
-		myWidgetIndexMap.erase(it);
+		myIsHitGridInvalid = true;
 
 		invalidateVertices();
 		widget->setParent(nullptr);
@@ -78,19 +172,12 @@ void Container::remove(std::shared_ptr<Widget> widget)
 
 bool Container::isContained(std::shared_ptr<const Widget> widget) const
 {
-	return myWidgetIndexMap.find(widget) != myWidgetIndexMap.end();
+	return isContained(widget.get());
 }
 
 bool Container::isContained(const Widget * widget) const
 {
-	for (const auto & curW : myWidgets)
-	{
-		if (curW.widget.get() == widget)
-		{
-			return true;
-		}
-	}
-	return false;
+	return getWidgetIndex(widget) != myWidgets.size();
 }
 
 void Container::setFocusedWidget(std::shared_ptr<Widget> widget)
@@ -164,10 +251,12 @@ bool Container::isWidgetFocused(std::shared_ptr<const Widget> widget) const
 
 void Container::invalidateWidgetVertices(std::shared_ptr<Widget> widget)
 {
-	auto it = myWidgetIndexMap.find(widget);
-	if (it != myWidgetIndexMap.end())
+	std::size_t widgetIndex = getWidgetIndex(widget.get());
+	if (widgetIndex != myWidgets.size())
 	{
-		myWidgets[it->second].verticesInvalid = true;
+		myWidgets[widgetIndex].verticesInvalid = true;
+		myHasPendingWidgets = true;
+		myIsHitGridInvalid = true;
 		invalidateVertices();
 	}
 }
@@ -175,9 +264,30 @@ void Container::invalidateWidgetVertices(std::shared_ptr<Widget> widget)
 void Container::invalidateAllWidgetVertices()
 {
 	myAllVerticesInvalid = true;
+	myHasPendingWidgets = true;
+	myIsHitGridInvalid = true;
 	invalidateVertices();
 }
 
+void Container::getMemoryUsage(MemoryUsage & usage) const
+{
+	Widget::getMemoryUsage(usage);
+
+	usage.add("container widget lists", MemoryUsage::getVectorBytes(myWidgets), myWidgets.size());
+	myHitGrid.getMemoryUsage(usage);
+
+	if (myRenderCache != nullptr)
+	{
+		usage.add("container render caches", sizeof(sf::RenderTexture)
+				+ myRenderCache->getSize().x * myRenderCache->getSize().y * 4, 1);
+	}
+
+	for (const WidgetInfo & info : myWidgets)
+	{
+		info.widget->getMemoryUsage(usage);
+	}
+}
+
 void Container::debug() const
 {
 	/*
@@ -203,11 +313,9 @@ void Container::debug() const
 
 void Container::sendWidgetToFront(std::shared_ptr<Widget> widget)
 {
-	auto it = myWidgetIndexMap.find(widget);
-	if (it == myWidgetIndexMap.end())
+	std::size_t widgetIndex = getWidgetIndex(widget.get());
+	if (widgetIndex == myWidgets.size())
 		return;
-
-	std::size_t widgetIndex = it->second;
 	int zpos = widget->getZPosition();
 
 	// first skip linked widgets (if widget even has linked widgets).
@@ -240,11 +348,9 @@ void Container::sendWidgetToFront(std::shared_ptr<Widget> widget)
 
 void Container::sendWidgetToBack(std::shared_ptr<Widget> widget)
 {
-	auto it = myWidgetIndexMap.find(widget);
-	if (it == myWidgetIndexMap.end())
+	std::size_t widgetIndex = getWidgetIndex(widget.get());
+	if (widgetIndex == myWidgets.size())
 		return;
-
-	std::size_t widgetIndex = it->second;
 	int zpos = widget->getZPosition();
 
 	int searchIndex;
@@ -255,8 +361,13 @@ void Container::sendWidgetToBack(std::shared_ptr<Widget> widget)
 		if (myWidgets[searchIndex].widget->getLinkParent() == widget->getLinkParent() &&
 			myWidgets[searchIndex].widget->getZPosition() < zpos)
 		{
-			// reinsert widget at found position.
-			moveWidget(widgetIndex, searchIndex);
+			// reinsert widget after found widget and its linked widgets.
+			std::size_t insertIndex = searchIndex + 1;
+			while (insertIndex < widgetIndex && myWidgets[insertIndex].widget->checkLinkParentRecursive(myWidgets[searchIndex].widget))
+			{
+				++insertIndex;
+			}
+			moveWidget(widgetIndex, insertIndex);
 			return;
 		}
 	}
@@ -267,11 +378,9 @@ void Container::sendWidgetToBack(std::shared_ptr<Widget> widget)
 
 void Container::updateWidgetZPosition(std::shared_ptr<Widget> widget)
 {
-	auto it = myWidgetIndexMap.find(widget);
-	if (it == myWidgetIndexMap.end())
+	std::size_t widgetIndex = getWidgetIndex(widget.get());
+	if (widgetIndex == myWidgets.size())
 		return;
-
-	std::size_t widgetIndex = it->second;
 	int zpos = widget->getZPosition();
 
 	std::size_t insertIndex = widgetIndex;
@@ -283,11 +392,9 @@ void Container::updateWidgetZPosition(std::shared_ptr<Widget> widget)
 		std::shared_ptr<Widget> parent = widget->getLinkParent();
 
 		// find link parent.
-		auto itP = myWidgetIndexMap.find(parent);
-		if (itP == myWidgetIndexMap.end())
+		std::size_t parentIndex = getWidgetIndex(parent.get());
+		if (parentIndex == myWidgets.size())
 			return;
-
-		std::size_t parentIndex = itP->second;
 		std::size_t searchIndex;
 
 		// loop through widget vector starting at one past link parent, ending at vector end or
@@ -349,6 +456,32 @@ bool Container::isVertexRenderable() const
 	//return myIsVertexRenderable;
 }
 
+void Container::setRenderCacheEnabled(bool enabled)
+{
+	if (myIsRenderCacheEnabled != enabled)
+	{
+		myIsRenderCacheEnabled = enabled;
+		myIsRenderCacheInvalid = true;
+
+		if (!enabled)
+		{
+			myRenderCache = nullptr;
+		}
+
+		invalidateRender();
+	}
+}
+
+bool Container::isRenderCacheEnabled() const
+{
+	return myIsRenderCacheEnabled;
+}
+
+bool Container::isDrawnInsideRect() const
+{
+	return myIsRenderCacheEnabled;
+}
+
 sf::Transform Container::getContainerTransform() const
 {
 	return sf::Transform::Identity;
@@ -376,6 +509,11 @@ bool Container::isManagingFocus() const
 	return true;
 }
 
+bool Container::isSkippingIdleWidgets() const
+{
+	return false;
+}
+
 void Container::addWidgetObserver(Observer* observer)
 {
 	if (!isWidgetObserver(observer))
@@ -436,8 +574,9 @@ bool Container::doAdd(std::shared_ptr<Widget> widget)
 
 		widget->setParent(std::dynamic_pointer_cast<Container>(shared_from_this()));
 
-		myWidgetIndexMap[widget] = myWidgets.size();
+		widget->myContainerIndex = myWidgets.size();
 		myWidgets.push_back(widget);
+		myIsHitGridInvalid = true;
 
 		//myIsVertexRenderable = false;
 
@@ -502,6 +641,8 @@ void Container::onProcessContainer(WidgetEvents & events)
 void Container::onProcess(const WidgetEvents & events)
 {
 	sf::Transform conTransform = events.transform * getContainerTransform();
+	const sf::Transform & conInverse = getCachedInverse(conTransform, myProcessContainerTransform,
+			myProcessContainerInverse);
 
 	// copy events to allow modification by container.
 	WidgetEvents cEvents(events);
@@ -510,28 +651,59 @@ void Container::onProcess(const WidgetEvents & events)
 	onProcessContainer(cEvents);
 
 	// check if mouse cursor is within container bounding box (mouse focus).
-	if (!getContainerBoundingBox().contains(conTransform.getInverse() * cEvents.conEvents.mousePosition))
+	if (!getContainerBoundingBox().contains(conInverse * cEvents.conEvents.mousePosition))
 		cEvents.mouseFocus = false;
 
 	// check if this container is currently focused (keyboard focus).
 	if (getParent() && !isFocused())
 		cEvents.keyboardFocus = false;
 
+	// without input, focus or changes, idle widgets would not change their state.
+	if (isSkippingIdleWidgets() && !cEvents.mouseFocus && !cEvents.keyboardFocus && !myHasPendingWidgets
+		&& !containerPriv::hasInputEvents(cEvents.conEvents))
+	{
+		return;
+	}
+
 	// keep track of whether the mouse is over any widget.
 	bool widgetMouseOver = false;
 
 	// check if the left mouse button was just pressed.
 	bool mousePressed = events.pressedInputs.contains(sf::Mouse::Left);
 
-	// temporary copy of widget vector, for when widgets change their order.
-	auto widgetVec = myWidgets;
+	// snapshot of the widget order, for when widgets change their order.
+	std::vector<std::shared_ptr<Widget> > & arena = containerPriv::getProcessArena();
+	std::size_t arenaBegin = arena.size();
 
-	// process widgets in reverse rendering order.
-	for (auto it = widgetVec.rbegin(); it != widgetVec.rend(); ++it)
+	for (const WidgetInfo & info : myWidgets)
 	{
-		Widget & widget = *it->widget;
+		arena.push_back(info.widget);
+	}
 
-		widget.process(WidgetEvents(cEvents.conEvents, conTransform * widget.getTransform(), cEvents.mouseFocus && widget.isVisible(), cEvents.keyboardFocus && widget.isVisible()));
+	myHasPendingWidgets = false;
+
+	// only widgets near the mouse need to check for mouseover.
+	if (cEvents.mouseFocus)
+	{
+		updateHitCandidates(conInverse, cEvents.conEvents);
+	}
+
+	// process widgets in reverse rendering order. nested containers may grow the arena, so index it.
+	for (std::size_t index = arena.size(); index > arenaBegin; --index)
+	{
+		Widget & widget = *arena[index - 1];
+
+		sf::Transform transform = conTransform * widget.getTransform();
+		const sf::Transform & inverse = getCachedInverse(transform, widget.myProcessTransform,
+				widget.myProcessInverseTransform);
+
+		widget.process(WidgetEvents(cEvents.conEvents, transform, inverse, cEvents.mouseFocus && widget.isVisible(),
+				cEvents.keyboardFocus && widget.isVisible()), isHitCandidate(widget));
+
+		if (widget.isMouseOver() || widget.myIsMouseDown != 0)
+		{
+			myHasPendingWidgets = true;
+		}
 
 		// only allow the topmost widget to respond to mouse events.
 		if (widget.isVisible() && widget.isMouseOver())
@@ -544,7 +716,7 @@ void Container::onProcess(const WidgetEvents & events)
 				widget.acquireFocus();
 
 				// send link parents to front recursively.
-				std::shared_ptr<Widget> linkChain = it->widget;
+				std::shared_ptr<Widget> linkChain = arena[index - 1];
 				while (linkChain)
 				{
 					linkChain->sendToFront();
@@ -554,6 +726,8 @@ void Container::onProcess(const WidgetEvents & events)
 		}
 	}
 
+	arena.resize(arenaBegin);
+
 	// unfocus widget if mouse button 1 was pressed on the container background.
 	if (cEvents.mouseFocus && mousePressed && !widgetMouseOver)
 	{
@@ -565,6 +739,20 @@ void Container::onDraw(sf::RenderTarget & target, sf::RenderStates states) const
 {
 	states.transform *= getTransform();
 
+	if (isRenderCacheEnabled() && updateRenderCache(states.texture))
+	{
+		// the cache holds colors premultiplied by their alpha values.
+		states.blendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+		target.draw(sf::Sprite(myRenderCache->getTexture()), states);
+		Profiler::count("GUI draw calls", 1);
+		return;
+	}
+
+	drawContents(target, states);
+}
+
+void Container::drawContents(sf::RenderTarget & target, sf::RenderStates states) const
+{
 	bool needWidgetTransform = true;
 	sf::RenderStates widgetStates;
 
@@ -579,23 +767,38 @@ void Container::onDraw(sf::RenderTarget & target, sf::RenderStates states) const
 	}
 
 	// vertex cache start position. already add pre-render vertices.
-	std::size_t vertBegin = 0, vertEnd = myVertexCountPrepend;
+	std::size_t vertBegin = 0, vertEnd = myVertexCapacityPrepend;
+
+	// widgets that overlap nothing drawn after them are drawn last, so the
+	// vertices around them are drawn in a single call.
+	std::vector<const Widget *> & deferredWidgets = containerPriv::getDeferredWidgets();
+	std::size_t deferredBegin = deferredWidgets.size();
 
 	// render widgets.
-	for (auto it = myWidgets.begin(); it != myWidgets.end(); ++it)
+	for (std::size_t i = 0; i < myWidgets.size(); ++i)
 	{
-		Widget & widget = *it->widget;
+		const WidgetInfo & info = myWidgets[i];
+		Widget & widget = *info.widget;
 
 		// widget is vertex-renderable and has a vertex cache entry.
 		if (widget.isVertexRenderable())
 		{
-			vertEnd += it->cachedVertexCount;
+			vertEnd += info.cachedVertexCapacity;
 		}
 		else if (widget.isVisible())
 		{
+			if (isWidgetDeferrable(i))
+			{
+				deferredWidgets.push_back(&widget);
+				continue;
+			}
+
 			// draw everything up until the current vertex cache position.
 			if (vertBegin < vertEnd)
+			{
 				target.draw(myVertexCache.data() + vertBegin, vertEnd - vertBegin, sf::Triangles, states);
+				Profiler::count("GUI draw calls", 1);
+			}
 
 			vertBegin = vertEnd;
 
@@ -618,7 +821,117 @@ void Container::onDraw(sf::RenderTarget & target, sf::RenderStates states) const
 	vertEnd += myVertexCountAppend;
 
 	// draw any remaining vertices.
-	target.draw(myVertexCache.data() + vertBegin, vertEnd - vertBegin, sf::Triangles, states);
+	if (vertBegin < vertEnd)
+	{
+		target.draw(myVertexCache.data() + vertBegin, vertEnd - vertBegin, sf::Triangles, states);
+		Profiler::count("GUI draw calls", 1);
+	}
+
+	// draw deferred widgets in their original order.
+	if (deferredWidgets.size() > deferredBegin)
+	{
+		widgetStates = states;
+		widgetStates.transform *= getContainerTransform();
+
+		for (std::size_t i = deferredBegin; i < deferredWidgets.size(); ++i)
+		{
+			if (isClippingWidgets())
+				drawClipped(*deferredWidgets[i], target, widgetStates, clipRect);
+			else
+				target.draw(*deferredWidgets[i], widgetStates);
+		}
+
+		deferredWidgets.resize(deferredBegin);
+	}
+}
+
+bool Container::updateRenderCache(const sf::Texture * texture) const
+{
+	sf::Vector2u size(std::ceil(getSize().x), std::ceil(getSize().y));
+
+	if (size.x == 0 || size.y == 0)
+	{
+		return false;
+	}
+
+	if (myRenderCache == nullptr || myRenderCache->getSize() != size)
+	{
+		myRenderCache = makeUnique<sf::RenderTexture>();
+
+		if (!myRenderCache->create(size.x, size.y))
+		{
+			myRenderCache = nullptr;
+			return false;
+		}
+
+		myIsRenderCacheInvalid = true;
+	}
+
+	if (myIsRenderCacheInvalid)
+	{
+		ProfileZone zone("Container::updateRenderCache");
+
+		// activates the texture, so the clipping state of the target the
+		// container is drawn to is not applied to the texture.
+		myRenderCache->clear(sf::Color::Transparent);
+		bool wasClipping = suspendClipping();
+
+		sf::RenderStates states;
+		states.texture = texture;
+		drawContents(*myRenderCache, states);
+		myRenderCache->display();
+
+		myRenderCache->setActive(true);
+		resumeClipping(wasClipping);
+
+		myIsRenderCacheInvalid = false;
+		Profiler::count("GUI render cache updates", 1);
+	}
+
+	return true;
+}
+
+bool Container::isWidgetDeferrable(std::size_t index) const
+{
+	const Widget & widget = *myWidgets[index].widget;
+
+	if (!widget.isDrawnInsideRect())
+	{
+		return false;
+	}
+
+	// widget rectangle in vertex cache coordinates.
+	sf::FloatRect rect = (getContainerTransform() * widget.getTransform()).transformRect(widget.getBaseRect());
+
+	if (myVertexCountAppend != 0 && rect.intersects(myVertexBoundsAppend))
+	{
+		return false;
+	}
+
+	for (std::size_t i = index + 1; i < myWidgets.size(); ++i)
+	{
+		const WidgetInfo & info = myWidgets[i];
+		const Widget & later = *info.widget;
+
+		if (later.isVertexRenderable())
+		{
+			if (info.cachedVertexCount != 0 && rect.intersects(info.cachedVertexBounds))
+			{
+				return false;
+			}
+		}
+		else if (later.isVisible())
+		{
+			// the order of overlapping widgets must not change.
+			if (!later.isDrawnInsideRect() || rect.intersects(
+					(getContainerTransform() * later.getTransform()).transformRect(later.getBaseRect())))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
 }
 
 void Container::onUpdateVertexCachePrepend()
@@ -633,6 +946,11 @@ void Container::onUpdateVertexCacheAppend()
 
 void Container::onUpdateVertexCache()
 {
+	ProfileZone zone("Container::onUpdateVertexCache");
+
+	// every change within the container passes through here.
+	myIsRenderCacheInvalid = true;
+
 	// update vertices if necessary/possible.
 	for (auto it = myWidgets.begin(); it != myWidgets.end(); ++it)
 	{
@@ -641,43 +959,36 @@ void Container::onUpdateVertexCache()
 
 	myIsVertexRenderable = true;
 
-	// get cache size before pre-render vertices.
-	std::size_t oldCacheSizeDeco = myVertexCache.size();
+	// the cache consists of the pre-render range, one range per widget and
+	// the post-render vertices. ranges may hold more vertices than needed,
+	// the rest is filled with degenerate triangles.
+	std::size_t layoutSize = myVertexCapacityPrepend;
+	for (const WidgetInfo & info : myWidgets)
+	{
+		layoutSize += info.cachedVertexCapacity;
+	}
 
-	// append pre-render vertices.
+	// remove post-render vertices and the ranges of removed widgets.
+	assert(myVertexCache.size() >= layoutSize);
+	myVertexCache.resize(layoutSize);
+
+	// pre-render vertices are appended behind the ranges, then moved.
 	onUpdateVertexCachePrepend();
 
 	// above function should never remove vertices.
-	assert(myVertexCache.size() >= oldCacheSizeDeco);
-
-	// get number of vertices added.
-	std::size_t newDecoVertexCount = myVertexCache.size() - oldCacheSizeDeco;
+	assert(myVertexCache.size() >= layoutSize);
 
-	// compute difference.
-	int cacheSizeDiffDeco = newDecoVertexCount - myVertexCountPrepend;
+	std::size_t prependCount = myVertexCache.size() - layoutSize;
+	bool overflow = prependCount > myVertexCapacityPrepend;
 
-	// resize cache as needed.
-	if (cacheSizeDiffDeco > 0)
-		myVertexCache.insert(myVertexCache.begin(), cacheSizeDiffDeco, sf::Vertex());
-	else if (cacheSizeDiffDeco < 0)
-		myVertexCache.erase(myVertexCache.begin(), myVertexCache.begin() - cacheSizeDiffDeco);
+	// count the vertices of changed widgets. clipped vertices are stored
+	// in a buffer, as clipping changes the vertex count.
+	std::vector<sf::Vertex> & clipBuffer = containerPriv::getClipBuffer();
+	clipBuffer.clear();
 
-	// copy vertices to correct position.
-	std::memcpy(myVertexCache.data(), myVertexCache.data() + oldCacheSizeDeco + cacheSizeDiffDeco, newDecoVertexCount * sizeof(sf::Vertex));
-
-	// remove vertices from end of cache.
-	myVertexCache.erase(myVertexCache.end() - newDecoVertexCount, myVertexCache.end());
-
-	// set new vertex count.
-	myVertexCountPrepend = newDecoVertexCount;
-
-	// begin processing widget vertices.
-	std::size_t cachePos = myVertexCountPrepend;
-
-	// fetch vertices from vertex-renderable widgets.
-	for (auto it = myWidgets.begin(); it != myWidgets.end(); ++it)
+	for (WidgetInfo & info : myWidgets)
 	{
-		Widget & widget = *it->widget;
+		Widget & widget = *info.widget;
 
 		// get vertices if possible.
 		if (!widget.isVertexRenderable())
@@ -686,93 +997,159 @@ void Container::onUpdateVertexCache()
 			myIsVertexRenderable = false;
 		}
 
-		// also check if this widget needs updating.
-		if (myAllVerticesInvalid || it->verticesInvalid)
-		{
-			// first save old vertex cache size.
-			std::size_t oldCacheSize = myVertexCache.size();
+		if (!myAllVerticesInvalid && !info.verticesInvalid)
+			continue;
 
-			// update vertices if visible, erase if invisible or complex-rendered.
-			if (widget.isVisible() && widget.isVertexRenderable())
-			{
-				// buffer for widget vertices.
-				std::vector<sf::Vertex> vertexBuffer(widget.getVertices().size());
+		// mark all vertices as changed for the writing pass.
+		info.verticesInvalid = true;
 
-				// fill buffer with vertices quickly.
-				std::memcpy(vertexBuffer.data(), widget.getVertices().data(), widget.getVertices().size() * sizeof(sf::Vertex));
+		if (widget.isVisible() && widget.isVertexRenderable())
+		{
+			if (isClippingWidgets())
+			{
+				std::size_t clipBegin = clipBuffer.size();
+				containerPriv::appendTransformed(clipBuffer, widget.getVertices(),
+						getContainerTransform() * widget.getTransform());
+				clipVertices(clipBuffer, clipBegin, clipBuffer.size(), getContainerClipBox());
+				info.pendingVertexCount = clipBuffer.size() - clipBegin;
+			}
+			else
+			{
+				info.pendingVertexCount = widget.getVertices().size();
+			}
+		}
+		else
+		{
+			info.pendingVertexCount = 0;
+		}
 
-				// transform vertices.
-				for (auto itv = vertexBuffer.begin(); itv != vertexBuffer.begin() + vertexBuffer.size(); ++itv)
-					itv->position = (getContainerTransform() * widget.getTransform()) * itv->position;
+		if (info.pendingVertexCount > info.cachedVertexCapacity)
+			overflow = true;
+	}
 
-				// clip vertices.
-				if (isClippingWidgets())
-					clipVertices(vertexBuffer, 0, vertexBuffer.size(), getContainerClipBox());
+	if (overflow)
+	{
+		rebuildVertexRanges(layoutSize, prependCount);
+	}
+	else
+	{
+		// move pre-render vertices into their range.
+		std::copy(myVertexCache.begin() + layoutSize, myVertexCache.end(), myVertexCache.begin());
+		std::fill(myVertexCache.begin() + prependCount,
+				myVertexCache.begin() + std::max(prependCount, myVertexCountPrepend), sf::Vertex());
+		myVertexCache.resize(layoutSize);
+	}
 
-				// compute needed cache size difference to fit widget vertices.
-				int cacheSizeDiff = vertexBuffer.size() - it->cachedVertexCount;
+	myVertexCountPrepend = prependCount;
 
-				/*
-				if (cacheSizeDiff != 0)
-				{
-					std::cout << typeid(*this).name() << " changing cache size by " << cacheSizeDiff << std::endl;
-					std::cout << "widget: " << typeid(widget).name() << std::endl;
-					std::shared_ptr<TextWidget> textW = std::dynamic_pointer_cast<TextWidget>(it->widget);
-					if (textW) std::cout << "text: " << textW->getText() << std::endl;
-					std::cout << "old vertex count: " << it->cachedVertexCount << "; new: " << widget.getVertices().size() << std::endl;
-					std::cout << "current cache size: " << myVertexCache.size() << std::endl;
-				}
-				else
-				{
-					std::shared_ptr<TextWidget> textW = std::dynamic_pointer_cast<TextWidget>(it->widget);
-					if (textW) std::cout << "updatingT: " << textW->getText() << std::endl;
-					else std::cout << "updatingW: " << typeid(widget).name() << std::endl;
-				}
-				*/
+	// write changed widget vertices into their ranges.
+	std::size_t cachePos = myVertexCapacityPrepend;
+	std::size_t clipPos = 0;
+	std::size_t writtenCount = 0;
 
-				// resize cache as needed.
-				if (cacheSizeDiff > 0)
-					myVertexCache.insert(myVertexCache.begin() + cachePos, cacheSizeDiff, sf::Vertex());
-				else if (cacheSizeDiff < 0)
-					myVertexCache.erase(myVertexCache.begin() + cachePos, myVertexCache.begin() + cachePos - cacheSizeDiff);
+	for (WidgetInfo & info : myWidgets)
+	{
+		if (info.verticesInvalid)
+		{
+			Widget & widget = *info.widget;
+			std::size_t count = info.pendingVertexCount;
 
-				// copy vertices into vector quickly.
-				std::memcpy(myVertexCache.data() + cachePos, vertexBuffer.data(), vertexBuffer.size() * sizeof(sf::Vertex));
+			if (isClippingWidgets())
+			{
+				std::copy(clipBuffer.begin() + clipPos, clipBuffer.begin() + clipPos + count,
+						myVertexCache.begin() + cachePos);
+				clipPos += count;
 			}
-			else
+			else if (count != 0)
 			{
-				// erase vertices.
-				myVertexCache.erase(myVertexCache.begin() + cachePos, myVertexCache.begin() + cachePos + it->cachedVertexCount);
+				sf::Transform transform = getContainerTransform() * widget.getTransform();
+				const std::vector<sf::Vertex> & vertices = widget.getVertices();
+
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					sf::Vertex & vertex = myVertexCache[cachePos + i];
+					vertex = vertices[i];
+					vertex.position = transform.transformPoint(vertex.position);
+				}
 			}
 
-			// now compute new vertex count for this particular widget.
-			it->cachedVertexCount += myVertexCache.size() - oldCacheSize;
+			info.cachedVertexBounds = calculateVertexBoundingBox(myVertexCache.data() + cachePos, count);
+
+			// replace leftover vertices of a shrunk widget with degenerate triangles.
+			std::fill(myVertexCache.begin() + cachePos + count,
+					myVertexCache.begin() + cachePos + std::max(count, info.cachedVertexCount), sf::Vertex());
 
-			// mark vertices as valid.
-			it->verticesInvalid = false;
+			info.cachedVertexCount = count;
+			info.verticesInvalid = false;
+			writtenCount += count;
 		}
 
 		// increment cache position.
-		cachePos += it->cachedVertexCount;
+		cachePos += info.cachedVertexCapacity;
 	}
 
+	Profiler::count("Container vertices written", writtenCount);
+
 	// reset all invalid variable.
 	myAllVerticesInvalid = false;
 
-	// remove any remaining vertices from deleted widgets, as well as appended vertices.
-	myVertexCache.erase(myVertexCache.begin() + cachePos, myVertexCache.end());
-
-	// keep track of vertex count before post-render call, only for final assertion.
-	oldCacheSizeDeco = myVertexCache.size();
-
 	// re-add post-render vertices, no further special actions necessary.
 	onUpdateVertexCacheAppend();
 
 	// the above function should never remove vertices.
-	assert(myVertexCache.size() >= oldCacheSizeDeco);
+	assert(myVertexCache.size() >= cachePos);
 
 	// calculate appended vertex count.
 	myVertexCountAppend = myVertexCache.size() - cachePos;
+	myVertexBoundsAppend = calculateVertexBoundingBox(myVertexCache.data() + cachePos, myVertexCountAppend);
+}
+
+void Container::rebuildVertexRanges(std::size_t layoutSize, std::size_t prependCount)
+{
+	ProfileZone zone("Container::rebuildVertexRanges");
+	Profiler::count("Container vertex cache rebuilds", 1);
+
+	std::vector<sf::Vertex> & rebuilt = containerPriv::getRebuildBuffer();
+	rebuilt.clear();
+
+	// pre-render vertices are still stored behind the old ranges.
+	myVertexCapacityPrepend = containerPriv::getRangeCapacity(myVertexCapacityPrepend, prependCount);
+	rebuilt.resize(myVertexCapacityPrepend);
+	std::copy(myVertexCache.begin() + layoutSize, myVertexCache.end(), rebuilt.begin());
+
+	// the old prepend capacity is needed to locate the old widget ranges.
+	std::size_t oldPos = layoutSize;
+	for (const WidgetInfo & info : myWidgets)
+	{
+		oldPos -= info.cachedVertexCapacity;
+	}
+
+	for (WidgetInfo & info : myWidgets)
+	{
+		std::size_t count = info.verticesInvalid ? info.pendingVertexCount : info.cachedVertexCount;
+		std::size_t capacity = containerPriv::getRangeCapacity(info.cachedVertexCapacity, count);
+		std::size_t newPos = rebuilt.size();
+
+		rebuilt.resize(newPos + capacity);
+
+		// unchanged widgets keep their vertices, changed ones are written afterwards.
+		if (!info.verticesInvalid)
+		{
+			std::copy(myVertexCache.begin() + oldPos, myVertexCache.begin() + oldPos + info.cachedVertexCount,
+					rebuilt.begin() + newPos);
+		}
+		else
+		{
+			info.cachedVertexCount = 0;
+		}
+
+		oldPos += info.cachedVertexCapacity;
+		info.cachedVertexCapacity = capacity;
+	}
+
+	// the old cache becomes the next rebuild's buffer, keeping its allocation.
+	myVertexCache.swap(rebuilt);
+	myVertexCountPrepend = 0;
 }
 
 void Container::onMouseOver()
@@ -827,6 +1204,85 @@ void Container::setParentInterface(std::shared_ptr<Interface> parent)
 	}
 }
 
+void Container::updateHitCandidates(const sf::Transform & inverse, const ContainerEvents & events)
+{
+	sf::Vector2f position = inverse.transformPoint(events.mousePosition);
+
+	// the previous candidates remain valid.
+	if (!myIsHitGridInvalid && position == myHitTestPosition && events.mouseEvents.empty())
+	{
+		return;
+	}
+
+	if (myIsHitGridInvalid)
+	{
+		std::vector<sf::FloatRect> & rects = containerPriv::getHitRects();
+		rects.clear();
+
+		for (const WidgetInfo & info : myWidgets)
+		{
+			const Widget & widget = *info.widget;
+
+			if (widget.isVisible())
+			{
+				// widen the rectangle to make up for rounding errors of the
+				// widget's inverse transform.
+				sf::FloatRect rect = widget.getTransform().transformRect(widget.getMouseoverRect());
+				rects.push_back(sf::FloatRect(rect.left - 1.f, rect.top - 1.f, rect.width + 2.f, rect.height + 2.f));
+			}
+			else
+			{
+				rects.push_back(sf::FloatRect());
+			}
+		}
+
+		myHitGrid.build(rects);
+		myIsHitGridInvalid = false;
+		Profiler::count("Container hit grid rebuilds", 1);
+	}
+
+	myHitTestIndex++;
+	myHitTestPosition = position;
+
+	std::vector<std::size_t> & results = containerPriv::getHitResults();
+	results.clear();
+	myHitGrid.find(position, results);
+
+	for (const ContainerEvents::MouseEvent & event : events.mouseEvents)
+	{
+		myHitGrid.find(inverse.transformPoint(event.position), results);
+	}
+
+	for (std::size_t index : results)
+	{
+		myWidgets[index].hitTestIndex = myHitTestIndex;
+	}
+}
+
+bool Container::isHitCandidate(const Widget & widget) const
+{
+	// widgets may have changed since the hit test, and auto-sized widgets
+	// resize themselves before checking for mouseover.
+	if (myIsHitGridInvalid || widget.isAutoManagingWidth() || widget.isAutoManagingHeight())
+	{
+		return true;
+	}
+
+	std::size_t index = getWidgetIndex(&widget);
+	return index == myWidgets.size() || myWidgets[index].hitTestIndex == myHitTestIndex;
+}
+
+std::size_t Container::getWidgetIndex(const Widget * widget) const
+{
+	if (widget != nullptr && widget->myContainerIndex < myWidgets.size()
+			&& myWidgets[widget->myContainerIndex].widget.get() == widget)
+	{
+		return widget->myContainerIndex;
+	}
+
+	return myWidgets.size();
+}
+
 void Container::moveWidget(std::size_t sourcePos, std::size_t destPos)
 {
 	// initial checks.
@@ -861,40 +1317,18 @@ void Container::moveWidget(std::size_t sourcePos, std::size_t destPos)
 		return;
 	}
 
-	// update index map first.
-	if (sourcePos < destPos)
-	{
-		// forward.
-		for (std::size_t i = sourceEnd; i < destEnd; ++i)
-		{
-			myWidgetIndexMap[myWidgets[i].widget] -= moveWidgetCount;
-		}
-	}
-	else
-	{
-		// backward.
-		for (int i = sourcePos - 1; i >= (int)destPos; --i)
-		{
-			myWidgetIndexMap[myWidgets[i].widget] += moveWidgetCount;
-		}
-	}
-
-	// update index map for moved widgets.
-	for (std::size_t i = 0; i < moveWidgetCount; ++i)
-		myWidgetIndexMap[myWidgets[sourcePos + i].widget] = destPos + i;
-
 	// find vertex cache beginning for the source range.
 	std::size_t vertexSourceBegin = 0;
 	for (std::size_t i = 0; i < sourcePos; ++i)
 	{
-		vertexSourceBegin += myWidgets[i].cachedVertexCount;
+		vertexSourceBegin += myWidgets[i].cachedVertexCapacity;
 	}
 
 	// find vertex cache end for the source range.
 	std::size_t vertexSourceEnd = vertexSourceBegin;
 	for (std::size_t i = sourcePos; i < sourceEnd; ++i)
 	{
-		vertexSourceEnd += myWidgets[i].cachedVertexCount;
+		vertexSourceEnd += myWidgets[i].cachedVertexCapacity;
 	}
 
 	// find vertex cache beginning for the destination range.
@@ -905,7 +1339,7 @@ void Container::moveWidget(std::size_t sourcePos, std::size_t destPos)
 		vertexDestBegin = vertexSourceEnd;
 		for (std::size_t i = sourceEnd; i < destPos; ++i)
 		{
-			vertexDestBegin += myWidgets[i].cachedVertexCount;
+			vertexDestBegin += myWidgets[i].cachedVertexCapacity;
 		}
 	}
 	else
@@ -913,7 +1347,7 @@ void Container::moveWidget(std::size_t sourcePos, std::size_t destPos)
 		// moving backward or regions overlap: count from start.
 		for (std::size_t i = 0; i < destPos; ++i)
 		{
-			vertexDestBegin += myWidgets[i].cachedVertexCount;
+			vertexDestBegin += myWidgets[i].cachedVertexCapacity;
 		}
 	}
 
@@ -921,14 +1355,14 @@ void Container::moveWidget(std::size_t sourcePos, std::size_t destPos)
 	std::size_t vertexDestEnd = vertexDestBegin;
 	for (std::size_t i = destPos; i < destEnd; ++i)
 	{
-		vertexDestEnd += myWidgets[i].cachedVertexCount;
+		vertexDestEnd += myWidgets[i].cachedVertexCapacity;
 	}
 
 
 	// these vertex cache operations are OK to do here because the vertex cache remains the same size.
 
 	// get iterator to start of actual widget vertices.
-	auto vertexCacheStart (myVertexCache.begin() + myVertexCountPrepend);
+	auto vertexCacheStart (myVertexCache.begin() + myVertexCapacityPrepend);
 
 	// move vertices in vertex cache.
 	if (sourcePos < destPos)
@@ -977,14 +1411,27 @@ void Container::moveWidget(std::size_t sourcePos, std::size_t destPos)
 	myWidgets.insert(myWidgets.begin() + destPos, widgets.begin(), widgets.end());
 	*/
 
+	// the hit grid refers to widgets by index.
+	myIsHitGridInvalid = true;
+
+	// renumber the widgets between the old and new position.
+	for (std::size_t i = std::min(sourcePos, destPos); i < std::max(sourceEnd, destEnd); ++i)
+	{
+		myWidgets[i].widget->myContainerIndex = i;
+	}
+
 	/*
 	// sanity check.
 	for (std::size_t i = 0; i < myWidgets.size(); ++i)
 	{
-		if (myWidgetIndexMap[myWidgets[i].widget] != i)
-			std::cout << "fuck: " << myWidgetIndexMap[myWidgets[i].widget] << " != " << i << std::endl;
+		if (myWidgets[i].widget->myContainerIndex != i)
+			std::cout << "fuck: " << myWidgets[i].widget->myContainerIndex << " != " << i << std::endl;
 	}
 	*/
+
+	// the vertex ranges were moved along with the widgets, but the draw
+	// order changed.
+	invalidateVertices();
 }
 
 
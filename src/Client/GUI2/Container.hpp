@@ -2,8 +2,10 @@
 #define GUI2_CONTAINER_HPP
 
 #include "Client/GUI2/Widget.hpp"
+#include "Client/GUI2/Internal/HitGrid.hpp"
 #include "Client/GUI2/Internal/WidgetEvents.hpp"
 
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <memory>
 #include <unordered_map>
 #include <iterator>
@@ -70,6 +72,18 @@ public:
 	/// function should be called to draw the widget instead. (slower)
 	virtual bool isVertexRenderable() const;
 
+	/// enables/disables drawing this container through an off-screen
+	/// texture. the texture is only redrawn after a widget within the
+	/// container has changed, otherwise the container is drawn as a single
+	/// textured quad. drawing is clipped to the container's rectangle.
+	/// non-vertex-renderable widgets inside a cached container must call
+	/// invalidateRender() whenever their appearance changes.
+	void setRenderCacheEnabled(bool enabled);
+	bool isRenderCacheEnabled() const;
+
+	/// returns true if the render cache is enabled.
+	virtual bool isDrawnInsideRect() const override;
+
 
 	/// returns the transformation this container applies to its widgets.
 	virtual sf::Transform getContainerTransform() const;
@@ -86,6 +100,17 @@ public:
 	/// returns true if this container manages widget focus.
 	virtual bool isManagingFocus() const;
 
+	/// returns true if this container may skip processing its widgets in
+	/// frames without input, in which it has neither mouse nor keyboard
+	/// focus and no widget has changed, is hovered or is held. only
+	/// containers whose widgets exclusively react to input or to their own
+	/// changes should return true.
+	virtual bool isSkippingIdleWidgets() const;
+
+	/// adds the estimated memory used by this container and all contained
+	/// widgets to the specified memory usage object.
+	virtual void getMemoryUsage(MemoryUsage & usage) const override;
+
 
 	/// automatically makes the specified observer monitor all current
 	/// and future widgets in this container.
@@ -201,6 +226,14 @@ private:
 	// renders the container. TODO: description and stuff.
 	virtual void onDraw(sf::RenderTarget & target, sf::RenderStates states) const;
 
+	// draws the vertex cache and the non-vertex-renderable widgets. the
+	// container's transform must already be applied to the render states.
+	void drawContents(sf::RenderTarget & target, sf::RenderStates states) const;
+
+	// redraws the render cache if it is outdated or has the wrong size.
+	// returns false if the render cache texture could not be created.
+	bool updateRenderCache(const sf::Texture * texture) const;
+
 	// adds vertices to the container's vertex cache with untransformed vertices.
 	// prepend/append determine whether the vertices will be inserted before or
 	// after the vertices of the contained widgets.
@@ -209,8 +242,14 @@ private:
 	virtual void onUpdateVertexCacheAppend();
 
 	// builds a vertex cache for this container's vertex-renderable widgets.
+	// only the ranges of changed widgets are rewritten.
 	void onUpdateVertexCache();
 
+	// moves all vertex ranges to fit the pending vertex counts, adding slack
+	// to ranges that grow. the pre-render vertices are expected behind the
+	// old ranges, at the specified position.
+	void rebuildVertexRanges(std::size_t layoutSize, std::size_t prependCount);
+
 	// prevents unnecessary vertex cache updates on mouse actions.
 	virtual void onMouseOver();
 	virtual void onMouseAway();
@@ -232,8 +271,25 @@ private:
 	// constructs a container linked to an interface.
 	void setParentInterface(std::shared_ptr<Interface> interface);
 
+	// returns true if the non-vertex-renderable widget at the specified
+	// index overlaps nothing drawn after it, so it can be drawn last.
+	bool isWidgetDeferrable(std::size_t index) const;
+
+	// finds the widgets whose mouseover rectangles contain the mouse cursor
+	// or any mouse event, rebuilding the hit grid if necessary. skipped if
+	// neither the mouse nor any widget has moved since the last call.
+	void updateHitCandidates(const sf::Transform & inverse, const ContainerEvents & events);
+
+	// returns false if the specified widget is known to be outside the
+	// mouse cursor and all mouse events of the current frame.
+	bool isHitCandidate(const Widget & widget) const;
+
+	// returns the index of the specified widget in the widget vector, or the
+	// vector's size if the widget is not within this container.
+	std::size_t getWidgetIndex(const Widget * widget) const;
+
 	// moves the widget at the specified index to the destination index,
-	// updating the vertex cache and widget index map correctly.
+	// updating the vertex cache and the widgets' indices correctly.
 	void moveWidget(std::size_t sourcePos, std::size_t destPos);
 
 
@@ -245,28 +301,63 @@ private:
 		WidgetInfo(std::shared_ptr<Widget> widget) :
 			widget(widget),
 			cachedVertexCount(0),
-			verticesInvalid(true)
+			cachedVertexCapacity(0),
+			pendingVertexCount(0),
+			verticesInvalid(true),
+			hitTestIndex(0)
 		{}
 
 		std::shared_ptr<Widget> widget;
+
+		// number of vertices in the widget's range of the vertex cache, and
+		// the size of the range. unused vertices are degenerate.
 		std::size_t cachedVertexCount;
+		std::size_t cachedVertexCapacity;
+
+		// vertex count to be written during the current vertex cache update.
+		std::size_t pendingVertexCount;
+
+		// bounding box of the widget's vertices in the vertex cache.
+		sf::FloatRect cachedVertexBounds;
+
 		bool verticesInvalid;
+
+		// the last hit test in which the widget's mouseover rectangle
+		// contained the mouse cursor or a mouse event.
+		std::size_t hitTestIndex;
 	};
 
 	// a vector holding this container's widgets.
 	std::vector<WidgetInfo> myWidgets;
 
-	// maps each widget pointer to its index in the widget vector.
-	std::map<std::weak_ptr<const Widget>, std::size_t, std::owner_less<std::weak_ptr<const Widget> > > myWidgetIndexMap;
-
 	// true if all widgets in this container are vertex-renderable.
 	bool myIsVertexRenderable;
 
 	// true if all widgets' vertices are invalid.
 	bool myAllVerticesInvalid;
 
-	// number of vertices before/after the widget vertices.
+	// number of vertices before/after the widget vertices, and size of the
+	// range reserved for the vertices before the widget vertices.
 	std::size_t myVertexCountPrepend, myVertexCountAppend;
+	std::size_t myVertexCapacityPrepend;
+
+	// bounding box of the vertices after the widget vertices.
+	sf::FloatRect myVertexBoundsAppend;
+
+	// off-screen texture holding the drawn container if the render cache is
+	// enabled, and whether it has to be redrawn.
+	mutable std::unique_ptr<sf::RenderTexture> myRenderCache;
+	bool myIsRenderCacheEnabled;
+	mutable bool myIsRenderCacheInvalid;
+
+	// index of the widgets' mouseover rectangles in container space, and
+	// true if a widget has changed since it was built.
+	HitGrid myHitGrid;
+	bool myIsHitGridInvalid;
+
+	// number of the last hit test, and the mouse position it was done for.
+	std::size_t myHitTestIndex;
+	sf::Vector2f myHitTestPosition;
 
 	// a pointer to this container's parent interface.
 	std::weak_ptr<Interface> myParentInterface;
@@ -274,6 +365,14 @@ private:
 	// a pointer to the currently focused widget.
 	std::weak_ptr<Widget> myFocusedWidget;
 
+	// the transformation applied to this container's widgets during the last
+	// processing pass, and its inverse.
+	sf::Transform myProcessContainerTransform, myProcessContainerInverse;
+
+	// true if any widget changed since, or was hovered or held after the last
+	// processing pass.
+	bool myHasPendingWidgets;
+
 	// a list of pointers to current widget observers.
 	std::set<Observer*> myWidgetObservers;
 
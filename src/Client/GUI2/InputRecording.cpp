@@ -0,0 +1,171 @@
+#include "Client/GUI2/InputRecording.hpp"
+#include "Shared/Utils/DataStream.hpp"
+#include "Shared/Utils/Utilities.hpp"
+
+#include <fstream>
+#include <stdexcept>
+
+namespace gui2
+{
+
+namespace inputRecordingPriv
+{
+
+static const sf::Uint32 fileMagic = 0x5249454E; // "NEIR"
+static const sf::Uint32 fileVersion = 1;
+
+void writeEvents(DataStream & stream, const ContainerEvents & events)
+{
+	stream << events.mousePosition << events.heldInputs << events.pressedInputs << events.textInput
+		<< sf::Int32(events.mouseWheelDelta);
+
+	stream << sf::Uint32(events.mouseEvents.size());
+	for (const ContainerEvents::MouseEvent & event : events.mouseEvents)
+	{
+		stream << event.isPress << event.position << event.button;
+	}
+
+	stream << sf::Uint32(events.keyEvents.size());
+	for (const ContainerEvents::KeyEvent & event : events.keyEvents)
+	{
+		stream << event.isPress << event.code;
+	}
+}
+
+bool readEvents(DataStream & stream, ContainerEvents & events)
+{
+	sf::Int32 wheelDelta = 0;
+	stream >> events.mousePosition >> events.heldInputs >> events.pressedInputs >> events.textInput >> wheelDelta;
+	events.mouseWheelDelta = wheelDelta;
+
+	sf::Uint32 count = 0;
+
+	stream >> count;
+	for (sf::Uint32 i = 0; i < count && stream.hasMoreData(); ++i)
+	{
+		bool isPress = false;
+		sf::Vector2f position;
+		Input button;
+		stream >> isPress >> position >> button;
+		events.mouseEvents.emplace_back(isPress, position, button);
+	}
+
+	stream >> count;
+	for (sf::Uint32 i = 0; i < count && stream.hasMoreData(); ++i)
+	{
+		bool isPress = false;
+		Input code;
+		stream >> isPress >> code;
+		events.keyEvents.emplace_back(isPress, code);
+	}
+
+	return stream.isValid();
+}
+
+}
+
+InputRecording::Frame::Frame(const ContainerEvents & events, sf::Vector2u windowSize, bool focused) :
+	events(events),
+	windowSize(windowSize),
+	focused(focused)
+{
+}
+
+void InputRecording::clear()
+{
+	myFrames.clear();
+}
+
+void InputRecording::addFrame(const ContainerEvents & events, sf::Vector2u windowSize, bool focused)
+{
+	myFrames.emplace_back(events, windowSize, focused);
+}
+
+std::size_t InputRecording::getFrameCount() const
+{
+	return myFrames.size();
+}
+
+const InputRecording::Frame & InputRecording::getFrame(std::size_t index) const
+{
+	if (index >= myFrames.size())
+	{
+		throw std::out_of_range("Input recording frame " + std::to_string(index) + " does not exist.");
+	}
+
+	return myFrames[index];
+}
+
+bool InputRecording::saveToFile(const std::string & filename) const
+{
+	using namespace inputRecordingPriv;
+
+	DataStream stream;
+	stream.openMemory();
+
+	stream << fileMagic << fileVersion << sf::Uint32(myFrames.size());
+
+	for (const Frame & frame : myFrames)
+	{
+		stream << frame.windowSize.x << frame.windowSize.y << frame.focused;
+		writeEvents(stream, frame.events);
+	}
+
+	std::vector<char> data;
+	stream.exportToVector(data);
+
+	std::ofstream file(filename, std::ios::binary);
+	file.write(data.data(), data.size());
+	return file.good();
+}
+
+bool InputRecording::loadFromFile(const std::string & filename)
+{
+	using namespace inputRecordingPriv;
+
+	if (!fileExists(filename))
+	{
+		return false;
+	}
+
+	std::string data = readFile(filename);
+
+	DataStream stream;
+	stream.openMemory(data.data(), data.size());
+
+	sf::Uint32 magic = 0, version = 0, frameCount = 0;
+	stream >> magic >> version >> frameCount;
+
+	if (!stream.isValid() || magic != fileMagic || version != fileVersion)
+	{
+		return false;
+	}
+
+	std::vector<Frame> frames;
+
+	for (sf::Uint32 i = 0; i < frameCount; ++i)
+	{
+		if (!stream.hasMoreData())
+		{
+			return false;
+		}
+
+		sf::Vector2u windowSize;
+		bool focused = false;
+		stream >> windowSize.x >> windowSize.y >> focused;
+
+		ContainerEvents events;
+
+		if (!readEvents(stream, events))
+		{
+			return false;
+		}
+
+		frames.emplace_back(events, windowSize, focused);
+	}
+
+	myFrames = std::move(frames);
+	return true;
+}
+
+} // namespace gui2
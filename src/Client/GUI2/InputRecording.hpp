@@ -0,0 +1,60 @@
+#ifndef GUI2_INPUT_RECORDING_HPP
+#define GUI2_INPUT_RECORDING_HPP
+
+#include "Client/GUI2/Internal/WidgetEvents.hpp"
+
+#include <SFML/System/Vector2.hpp>
+#include <string>
+#include <vector>
+
+namespace gui2
+{
+
+/**
+ * a sequence of per-frame input states captured from an interface.
+ *
+ * each frame holds the container events that were passed to the interface's root container, along with the window
+ * size and focus state at the time. feeding the frames back into an interface in order reproduces the recorded
+ * session, as long as it starts from the same state (for example the same dungeon file).
+ */
+class InputRecording
+{
+public:
+
+	/// the input state of a single frame.
+	struct Frame
+	{
+		Frame(const ContainerEvents & events, sf::Vector2u windowSize, bool focused);
+
+		ContainerEvents events;
+		sf::Vector2u windowSize;
+		bool focused;
+	};
+
+	/// removes all frames.
+	void clear();
+
+	/// appends a frame to the recording.
+	void addFrame(const ContainerEvents & events, sf::Vector2u windowSize, bool focused);
+
+	/// returns the number of recorded frames.
+	std::size_t getFrameCount() const;
+
+	/// returns the frame with the specified index. throws std::out_of_range for invalid indices.
+	const Frame & getFrame(std::size_t index) const;
+
+	/// writes the recording to a file. returns false on failure.
+	bool saveToFile(const std::string & filename) const;
+
+	/// replaces the recording with the content of a file. returns false and leaves the recording unchanged if the
+	/// file could not be read or is not a valid recording.
+	bool loadFromFile(const std::string & filename);
+
+private:
+
+	std::vector<Frame> myFrames;
+};
+
+} // namespace gui2
+
+#endif
@@ -1,5 +1,7 @@
 #include "Client/GUI2/Application.hpp"
+#include "Shared/Utils/MakeUnique.hpp"
 #include "Shared/Utils/MiscMath.hpp"
+#include "Shared/Utils/Profiler.hpp"
 
 #include <limits>
 
@@ -13,7 +15,12 @@ Interface::Interface() :
 	myRootContainer(RootContainer::make()),
 	myParentApplication(0),
 	myWindowSize(1280, 720),
-	myWindowTitle("Unnamed window")
+	myWindowTitle("Unnamed window"),
+	myInputReplayFrame(0),
+	myIsIdle(false),
+	myIsUpdateRequested(false),
+	myHasTimedUpdate(false),
+	myHasPendingEvent(false)
 {
 }
 
@@ -97,14 +104,78 @@ bool Interface::isMouseCursorVisible() const
 }
 
 
+void Interface::setInputRecording(std::shared_ptr<InputRecording> recording)
+{
+	myInputRecording = recording;
+}
+
+std::shared_ptr<InputRecording> Interface::getInputRecording() const
+{
+	return myInputRecording;
+}
+
+void Interface::setInputReplay(std::shared_ptr<const InputRecording> recording)
+{
+	myInputReplay = recording;
+	myInputReplayFrame = 0;
+}
+
+bool Interface::isReplayingInput() const
+{
+	return myInputReplay != nullptr && myInputReplayFrame < myInputReplay->getFrameCount();
+}
+
+void Interface::setOffscreenRenderingEnabled(bool enabled)
+{
+	if (enabled && !myOffscreenTarget)
+	{
+		myOffscreenTarget = makeUnique<sf::RenderTexture>();
+	}
+	else if (!enabled)
+	{
+		myOffscreenTarget = nullptr;
+	}
+
+	myWindow.setVisible(!enabled);
+}
+
+bool Interface::isOffscreenRenderingEnabled() const
+{
+	return myOffscreenTarget != nullptr;
+}
+
+
+void Interface::requestUpdate()
+{
+	myIsUpdateRequested = true;
+}
+
+void Interface::requestUpdate(sf::Time delay)
+{
+	sf::Time updateTime = myUpdateClock.getElapsedTime() + delay;
+
+	if (!myHasTimedUpdate || updateTime < myUpdateTime)
+	{
+		myUpdateTime = updateTime;
+		myHasTimedUpdate = true;
+	}
+}
+
+
 sf::RenderTarget & Interface::getRenderTarget()
 {
-	return myWindow;
+	if (myOffscreenTarget)
+		return *myOffscreenTarget;
+	else
+		return myWindow;
 }
 
 const sf::RenderTarget & Interface::getRenderTarget() const
 {
-	return myWindow;
+	if (myOffscreenTarget)
+		return *myOffscreenTarget;
+	else
+		return myWindow;
 }
 
 void Interface::openWindow()
@@ -138,10 +209,27 @@ void Interface::init()
 
 void Interface::process()
 {
+	ProfileZone zone("Interface::process");
+
 	myContainerEvents.reset();
+	myIsUpdateRequested = false;
+	myHasTimedUpdate = false;
+
+	bool hasInput = false;
 
-	for (sf::Event event; myWindow.pollEvent(event); )
+	for (sf::Event event; pollEvent(event); )
 	{
+		hasInput = true;
+
+		// while replaying, only close requests are taken from the window.
+		if (isReplayingInput())
+		{
+			if (event.type == sf::Event::Closed)
+				onClose();
+
+			continue;
+		}
+
 		switch (event.type)
 		{
 		case sf::Event::Closed:
@@ -172,24 +260,58 @@ void Interface::process()
 		onEvent(event);
 	}
 
+	if (isReplayingInput())
+	{
+		applyReplayFrame();
+		hasInput = true;
+	}
+
+	if (myInputRecording)
+	{
+		myInputRecording->addFrame(myContainerEvents, myWindowSize, myHasFocus);
+	}
+
 	myRootContainer->setSize(sf::Vector2f(getSize()));
 
-	WidgetEvents wgtEvents = WidgetEvents(myContainerEvents, sf::Transform::Identity, isFocused(), isFocused());
+	WidgetEvents wgtEvents = WidgetEvents(myContainerEvents, sf::Transform::Identity, sf::Transform::Identity,
+			isFocused(), isFocused());
 
-	myRootContainer->process(wgtEvents);
-	onProcess(wgtEvents);
+	{
+		ProfileZone processZone("Interface::processWidgets");
+		myRootContainer->process(wgtEvents);
+		onProcess(wgtEvents);
+	}
+
+	// any widget change invalidates the root container's vertices.
+	bool hasChanged = myRootContainer->myIsVertexCacheInvalid;
 
 	myRootContainer->updateVertexCache();
 
-	myWindow.setView(sf::View(sf::FloatRect(0, 0, getSize().x, getSize().y)));
-	myWindow.clear(sf::Color(25, 45, 75));
+	myIsIdle = !hasInput && !hasChanged && !myIsUpdateRequested && !isOffscreenRenderingEnabled();
+
+	ProfileZone renderZone("Interface::render");
+
+	// the off-screen target follows the interface size, which may be set by an input replay.
+	if (myOffscreenTarget && myOffscreenTarget->getSize() != getSize())
+	{
+		myOffscreenTarget->create(getSize().x, getSize().y);
+	}
+
+	sf::RenderTarget & target = getRenderTarget();
+
+	target.setView(sf::View(sf::FloatRect(0, 0, getSize().x, getSize().y)));
+	target.clear(sf::Color(25, 45, 75));
 
 	sf::RenderStates states;
 	states.texture = getParentApplication().getMainTexture();
-	myRootContainer->draw(myWindow, states);
+	myRootContainer->draw(target, states);
 
 	onRender();
-	myWindow.display();
+
+	if (myOffscreenTarget)
+		myOffscreenTarget->display();
+	else
+		myWindow.display();
 }
 
 void Interface::onEvent(const sf::Event & event)
@@ -242,6 +364,53 @@ void Interface::internalInit(Application * parentApp)
 	openWindow();
 }
 
+void Interface::applyReplayFrame()
+{
+	const InputRecording::Frame & frame = myInputReplay->getFrame(myInputReplayFrame++);
+
+	myContainerEvents = frame.events;
+	myWindowSize = frame.windowSize;
+	myHasFocus = frame.focused;
+}
+
+bool Interface::pollEvent(sf::Event & event)
+{
+	if (myHasPendingEvent)
+	{
+		event = myPendingEvent;
+		myHasPendingEvent = false;
+		return true;
+	}
+
+	return myWindow.pollEvent(event);
+}
+
+bool Interface::isIdle() const
+{
+	return myIsIdle && !myIsUpdateRequested && !isReplayingInput()
+		&& (!hasTimedUpdate() || getTimeUntilUpdate() > sf::Time::Zero);
+}
+
+bool Interface::hasTimedUpdate() const
+{
+	return myHasTimedUpdate;
+}
+
+sf::Time Interface::getTimeUntilUpdate() const
+{
+	return myUpdateTime - myUpdateClock.getElapsedTime();
+}
+
+bool Interface::waitEvent(bool block)
+{
+	if (!myHasPendingEvent)
+	{
+		myHasPendingEvent = block ? myWindow.waitEvent(myPendingEvent) : myWindow.pollEvent(myPendingEvent);
+	}
+
+	return myHasPendingEvent;
+}
+
 sf::VideoMode Interface::findGoodVideoMode(sf::Vector2u compare) const
 {
 	const std::vector<sf::VideoMode> modes = sf::VideoMode::getFullscreenModes();
@@ -2,8 +2,12 @@
 #define GUI2_INTERFACE_HPP
 
 #include "Client/GUI2/Container.hpp"
+#include "Client/GUI2/InputRecording.hpp"
 
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
 #include <memory>
 
 namespace gui2
@@ -56,6 +60,42 @@ public:
 	/// returns the mouse cursor's visibility state on this interface.
 	bool isMouseCursorVisible() const;
 
+
+	/// appends the input of each processed frame to the specified
+	/// recording. a null pointer stops recording.
+	void setInputRecording(std::shared_ptr<InputRecording> recording);
+
+	/// returns the recording that input is currently appended to.
+	std::shared_ptr<InputRecording> getInputRecording() const;
+
+	/// replaces window input with the frames of the specified recording,
+	/// one frame per call to process(), starting with the first frame.
+	/// the window is still polled for close requests. a null pointer
+	/// returns to window input.
+	void setInputReplay(std::shared_ptr<const InputRecording> recording);
+
+	/// returns true while recorded frames remain to be replayed.
+	bool isReplayingInput() const;
+
+	/// renders into an off-screen texture instead of the window, and
+	/// hides the window while enabled.
+	void setOffscreenRenderingEnabled(bool enabled);
+
+	/// returns true if the interface renders off-screen.
+	bool isOffscreenRenderingEnabled() const;
+
+
+	/// requests that the interface is processed and rendered in the next
+	/// frame, even if no input arrives and no widget changes. should be
+	/// called every frame while an animation or background task is active.
+	void requestUpdate();
+
+	/// requests that the interface is processed and rendered once the
+	/// specified time has passed, even if no input arrives. the interface
+	/// may stay idle until then. like requestUpdate(), this only applies to
+	/// the next frame; when several requests are made, the earliest counts.
+	void requestUpdate(sf::Time delay);
+
 protected:
 
 	/// returns a RenderTarget corresponding to this interface's window.
@@ -113,6 +153,27 @@ private:
 	// returns the closest videomode to the specified size vector.
 	sf::VideoMode findGoodVideoMode(sf::Vector2u compare) const;
 
+	// replaces the container events, window size and focus state with the
+	// next frame of the input replay.
+	void applyReplayFrame();
+
+	// returns the event kept by waitEvent(), or the next window event.
+	bool pollEvent(sf::Event & event);
+
+	// returns true if the last frame received no input, changed no widget
+	// and requested no update, so the next frame would look the same.
+	bool isIdle() const;
+
+	// returns true if a timed update was requested, and the time until it
+	// is due (zero or negative if it is already due).
+	bool hasTimedUpdate() const;
+	sf::Time getTimeUntilUpdate() const;
+
+	// waits for the next window event and keeps it for the next call to
+	// process(). if "block" is false, only checks for a pending event.
+	// returns true if an event was received.
+	bool waitEvent(bool block);
+
 
 	// the interface's window.
 	sf::RenderWindow myWindow;
@@ -137,6 +198,31 @@ private:
 	// window title.
 	sf::String myWindowTitle;
 
+	// recording that processed input is appended to, if any.
+	std::shared_ptr<InputRecording> myInputRecording;
+
+	// recording that replaces window input, if any, and the index of the
+	// next frame to replay.
+	std::shared_ptr<const InputRecording> myInputReplay;
+	std::size_t myInputReplayFrame;
+
+	// off-screen render target. used instead of the window if not null.
+	std::unique_ptr<sf::RenderTexture> myOffscreenTarget;
+
+	// true if the last frame had no effect, and if an update was requested
+	// during the current frame.
+	bool myIsIdle;
+	bool myIsUpdateRequested;
+
+	// time at which a timed update is due, measured by the update clock.
+	sf::Clock myUpdateClock;
+	sf::Time myUpdateTime;
+	bool myHasTimedUpdate;
+
+	// event received by waitEvent(), to be processed in the next frame.
+	sf::Event myPendingEvent;
+	bool myHasPendingEvent;
+
 	friend class Application;
 	friend class Interface::RootContainer;
 
@@ -0,0 +1,150 @@
+#include "Client/GUI2/Internal/HitGrid.hpp"
+#include "Shared/Utils/MemoryUsage.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gui2
+{
+
+// upper limit for the number of columns and rows.
+static const std::size_t maxGridSize = 16;
+
+HitGrid::HitGrid() :
+	myColumns(0),
+	myRows(0)
+{
+}
+
+void HitGrid::build(const std::vector<sf::FloatRect> & rects)
+{
+	myRects = rects;
+	myCellStarts.clear();
+	myEntries.clear();
+	myColumns = 0;
+	myRows = 0;
+
+	// compute the bounding box of all non-empty rectangles.
+	std::size_t rectCount = 0;
+	float left = 0.f, top = 0.f, right = 0.f, bottom = 0.f;
+
+	for (const sf::FloatRect & rect : myRects)
+	{
+		if (rect.width <= 0.f || rect.height <= 0.f)
+		{
+			continue;
+		}
+
+		if (rectCount++ == 0)
+		{
+			left = rect.left;
+			top = rect.top;
+			right = rect.left + rect.width;
+			bottom = rect.top + rect.height;
+		}
+		else
+		{
+			left = std::min(left, rect.left);
+			top = std::min(top, rect.top);
+			right = std::max(right, rect.left + rect.width);
+			bottom = std::max(bottom, rect.top + rect.height);
+		}
+	}
+
+	if (rectCount == 0)
+	{
+		return;
+	}
+
+	myBounds = sf::FloatRect(left, top, right - left, bottom - top);
+
+	std::size_t gridSize = std::min<std::size_t>(std::ceil(std::sqrt(float(rectCount))), maxGridSize);
+	myColumns = gridSize;
+	myRows = gridSize;
+	myCellSize = sf::Vector2f(myBounds.width / myColumns, myBounds.height / myRows);
+
+	// count the entries of each cell, then turn the counts into start indices.
+	myCellStarts.assign(myColumns * myRows + 1, 0);
+
+	for (const sf::FloatRect & rect : myRects)
+	{
+		if (rect.width <= 0.f || rect.height <= 0.f)
+		{
+			continue;
+		}
+
+		for (std::size_t row = getRow(rect.top); row <= getRow(rect.top + rect.height); ++row)
+		{
+			for (std::size_t column = getColumn(rect.left); column <= getColumn(rect.left + rect.width); ++column)
+			{
+				myCellStarts[row * myColumns + column + 1]++;
+			}
+		}
+	}
+
+	for (std::size_t cell = 1; cell < myCellStarts.size(); ++cell)
+	{
+		myCellStarts[cell] += myCellStarts[cell - 1];
+	}
+
+	// fill the cells, using the start indices as write positions.
+	myEntries.resize(myCellStarts.back());
+	std::vector<std::size_t> writePositions(myCellStarts.begin(), myCellStarts.end() - 1);
+
+	for (std::size_t i = 0; i < myRects.size(); ++i)
+	{
+		const sf::FloatRect & rect = myRects[i];
+
+		if (rect.width <= 0.f || rect.height <= 0.f)
+		{
+			continue;
+		}
+
+		for (std::size_t row = getRow(rect.top); row <= getRow(rect.top + rect.height); ++row)
+		{
+			for (std::size_t column = getColumn(rect.left); column <= getColumn(rect.left + rect.width); ++column)
+			{
+				myEntries[writePositions[row * myColumns + column]++] = i;
+			}
+		}
+	}
+}
+
+void HitGrid::find(sf::Vector2f point, std::vector<std::size_t> & results) const
+{
+	if (myColumns == 0 || !myBounds.contains(point))
+	{
+		return;
+	}
+
+	std::size_t cell = getRow(point.y) * myColumns + getColumn(point.x);
+
+	for (std::size_t entry = myCellStarts[cell]; entry < myCellStarts[cell + 1]; ++entry)
+	{
+		if (myRects[myEntries[entry]].contains(point))
+		{
+			results.push_back(myEntries[entry]);
+		}
+	}
+}
+
+void HitGrid::getMemoryUsage(MemoryUsage & usage) const
+{
+	usage.add("container hit grids", MemoryUsage::getVectorBytes(myRects) + MemoryUsage::getVectorBytes(myCellStarts)
+			+ MemoryUsage::getVectorBytes(myEntries));
+}
+
+std::size_t HitGrid::getColumn(float x) const
+{
+	float column = std::floor((x - myBounds.left) / myCellSize.x);
+	return std::min<std::size_t>(std::max(column, 0.f), myColumns - 1);
+}
+
+std::size_t HitGrid::getRow(float y) const
+{
+	float row = std::floor((y - myBounds.top) / myCellSize.y);
+	return std::min<std::size_t>(std::max(row, 0.f), myRows - 1);
+}
+
+
+} // namespace gui2
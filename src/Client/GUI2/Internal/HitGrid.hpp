@@ -0,0 +1,64 @@
+#ifndef GUI2_INTERNAL_HIT_GRID_HPP
+#define GUI2_INTERNAL_HIT_GRID_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+class MemoryUsage;
+
+namespace gui2
+{
+
+
+/**
+ * a uniform grid over a list of rectangles, used to find the rectangles
+ * containing a point without testing all of them.
+ * the grid covers the bounding box of all rectangles and has roughly one
+ * cell per rectangle.
+ */
+class HitGrid
+{
+public:
+
+	/// creates an empty grid.
+	HitGrid();
+
+	/// rebuilds the grid from the specified rectangles. rectangles are
+	/// identified by their index. empty rectangles are never found.
+	void build(const std::vector<sf::FloatRect> & rects);
+
+	/// appends the indices of all rectangles containing the specified point
+	/// to the result vector.
+	void find(sf::Vector2f point, std::vector<std::size_t> & results) const;
+
+	/// adds the estimated memory used by the grid to the specified memory
+	/// usage object.
+	void getMemoryUsage(MemoryUsage & usage) const;
+
+private:
+
+	// returns the column/row containing the specified coordinate, clamped
+	// to the grid.
+	std::size_t getColumn(float x) const;
+	std::size_t getRow(float y) const;
+
+	// the rectangles and their bounding box.
+	std::vector<sf::FloatRect> myRects;
+	sf::FloatRect myBounds;
+
+	// grid dimensions.
+	std::size_t myColumns, myRows;
+	sf::Vector2f myCellSize;
+
+	// rectangle indices of all cells, stored cell by cell. the entries of
+	// a cell start at the cell's start index and end at the next cell's.
+	std::vector<std::size_t> myCellStarts;
+	std::vector<std::size_t> myEntries;
+};
+
+
+} // namespace gui2
+
+#endif
@@ -85,6 +85,7 @@ private:
 	void processEvent(const sf::Event & event);
 
 	friend class Interface;
+	friend class InputRecording;
 };
 
 
@@ -127,8 +128,10 @@ public:
 private:
 
 	/// constructs widget events from container events and a transformed mouse position.
-	WidgetEvents(const ContainerEvents & events, const sf::Transform & transform, bool mouseFocus, bool keyboardFocus) :
-		mousePosition(transform.getInverse().transformPoint(events.mousePosition)),
+	/// the inverse transform is passed in, so it can be cached between frames.
+	WidgetEvents(const ContainerEvents & events, const sf::Transform & transform, const sf::Transform & inverseTransform,
+			bool mouseFocus, bool keyboardFocus) :
+		mousePosition(inverseTransform.transformPoint(events.mousePosition)),
 		heldInputs(events.heldInputs),
 		pressedInputs(events.pressedInputs),
 		textInput(events.textInput),
@@ -136,6 +139,7 @@ private:
 		mouseFocus(mouseFocus),
 		keyboardFocus(keyboardFocus),
 		transform(transform),
+		inverseTransform(inverseTransform),
 		conEvents(events)
 	{}
 
@@ -144,6 +148,7 @@ private:
 
 	// for computation of transformed mouse positions.
 	const sf::Transform & transform;
+	const sf::Transform & inverseTransform;
 
 	// for data retrieval in processContainer().
 	const ContainerEvents & conEvents;
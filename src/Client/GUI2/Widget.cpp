@@ -1,6 +1,10 @@
 #include "Client/GUI2/Application.hpp"
+#include "Shared/Utils/MemoryUsage.hpp"
+#include "Shared/Utils/Profiler.hpp"
 #include "Shared/Utils/Utilities.hpp"
 
+#include <algorithm>
+
 namespace gui2
 {
 
@@ -23,7 +27,12 @@ Widget::Widget() :
 	myIsTransformInvalid(true),
 	myIsInverseTransformInvalid(true),
 
-	myIsVertexCacheInvalid(true)
+	myProcessTransform(),
+	myProcessInverseTransform(),
+
+	myIsVertexCacheInvalid(true),
+
+	myContainerIndex(0)
 {
 }
 
@@ -328,6 +337,11 @@ bool Widget::isVertexRenderable() const
 	return true;
 }
 
+bool Widget::isDrawnInsideRect() const
+{
+	return false;
+}
+
 sf::Transform Widget::getTransform() const
 {
 	if (myIsTransformInvalid)
@@ -378,12 +392,35 @@ void Widget::invalidateRender()
 		getParent()->invalidateWidgetVertices(shared_from_this());
 }
 
+void Widget::requestUpdate() const
+{
+	std::shared_ptr<Interface> interface = getParentInterface();
+
+	if (interface)
+		interface->requestUpdate();
+}
+
+void Widget::requestUpdate(sf::Time delay) const
+{
+	std::shared_ptr<Interface> interface = getParentInterface();
+
+	if (interface)
+		interface->requestUpdate(delay);
+}
+
 const std::vector<sf::Vertex> & Widget::getVertices() const
 {
 	return myVertexCache;
 }
 
-void Widget::process(const WidgetEvents & events)
+void Widget::getMemoryUsage(MemoryUsage & usage) const
+{
+	usage.add("widgets", sizeof(Widget) + MemoryUsage::SharedOverhead
+			+ myLinkedWidgets.size() * (sizeof(std::shared_ptr<Widget>) + MemoryUsage::NodeOverhead), 1);
+	usage.add("vertex caches", MemoryUsage::getVectorBytes(myVertexCache), myVertexCache.size());
+}
+
+void Widget::process(const WidgetEvents & events, bool isHitCandidate)
 {
 	// check automatic size.
 	if (isAutoManagingWidth() || isAutoManagingHeight())
@@ -396,7 +433,7 @@ void Widget::process(const WidgetEvents & events)
 	myIsClicked = 0;
 
 	// set mouse-over flag. mouse position is already pre-transformed.
-	bool mouseOver = events.mouseFocus && checkMouseover(events.mousePosition) && isEnabled();
+	bool mouseOver = isHitCandidate && events.mouseFocus && checkMouseover(events.mousePosition) && isEnabled();
 
 	if (myIsMouseOver != mouseOver)
 	{
@@ -418,10 +455,10 @@ void Widget::process(const WidgetEvents & events)
 		ContainerEvents::MouseEvent event = *it;
 		MouseBitmask buttonMask = convertMouseButtonBitmask(event.button);
 
-		sf::Vector2f convPos = events.transform.getInverse().transformPoint(event.position);
+		sf::Vector2f convPos = events.inverseTransform.transformPoint(event.position);
 
 		// check if mouse is over widget (and widget is not obstructed).
-		if (events.mouseFocus && checkMouseover(convPos))
+		if (isHitCandidate && events.mouseFocus && checkMouseover(convPos))
 		{
 			// handle mouse presses/releases on the widget, check for successful click.
 			if (event.isPress)
@@ -789,6 +826,7 @@ void Widget::onDraw(sf::RenderTarget & target, sf::RenderStates states) const
 {
 	states.transform *= getTransform();
 	target.draw(myVertexCache.data(), myVertexCache.size(), sf::Triangles, states);
+	Profiler::count("GUI draw calls", 1);
 }
 
 void Widget::onUpdateVertexCache()
@@ -893,6 +931,11 @@ bool Widget::checkMouseover(sf::Vector2f pos) const
 	return getBaseRect().contains(pos);
 }
 
+sf::FloatRect Widget::getMouseoverRect() const
+{
+	return getBaseRect();
+}
+
 /*
 std::shared_ptr<const btx::Font> Widget::onGetFont(int index) const
 {
@@ -949,4 +992,17 @@ Widget::MouseBitmask Widget::convertMouseButtonBitmask(Input button)
 	}
 }
 
+const sf::Transform & Widget::getCachedInverse(const sf::Transform & transform, sf::Transform & cachedTransform,
+		sf::Transform & cachedInverse)
+{
+	// comparing 16 floats is cheaper than inverting the matrix.
+	if (!std::equal(transform.getMatrix(), transform.getMatrix() + 16, cachedTransform.getMatrix()))
+	{
+		cachedTransform = transform;
+		cachedInverse = transform.getInverse();
+	}
+
+	return cachedInverse;
+}
+
 } // namespace gui2
@@ -8,11 +8,14 @@
 #include "Shared/Utils/Observer.hpp"
 
 #include <SFML/System/Vector2.hpp>
+#include <SFML/System/Time.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <memory>
 #include <set>
 
+class MemoryUsage;
+
 namespace gui2
 {
 
@@ -170,6 +173,12 @@ public:
 	/// function should be called to draw the widget instead. (slower)
 	virtual bool isVertexRenderable() const;
 
+	/// returns true if the widget's draw() never renders outside of the
+	/// widget's base rect. containers may then draw a non-vertex-renderable
+	/// widget after the vertices of later widgets it does not overlap,
+	/// saving draw calls. (default: false)
+	virtual bool isDrawnInsideRect() const;
+
 	/// returns the immediate transformation applied to this widget.
 	sf::Transform getTransform() const;
 
@@ -189,13 +198,29 @@ public:
 	/// notifies the parent container that the widget should be redrawn.
 	void invalidateRender();
 
+	/// asks the parent interface to process another frame, even if no input
+	/// arrives. call this every frame while the widget is animated.
+	void requestUpdate() const;
+
+	/// asks the parent interface to process another frame once the
+	/// specified time has passed. call this every frame to wake up a
+	/// periodically refreshed widget without rendering every frame.
+	void requestUpdate(sf::Time delay) const;
+
 
 	/// returns this widget's pretransformed triangle vertices.
 	const std::vector<sf::Vertex> & getVertices() const;
 
+	/// adds the estimated memory used by this widget to the specified
+	/// memory usage object.
+	virtual void getMemoryUsage(MemoryUsage & usage) const;
+
 
-	/// called once per GUI update frame. calls onProcess().
-	void process(const WidgetEvents & events);
+	/// called once per GUI update frame. calls onProcess(). if
+	/// isHitCandidate is false, the mouse cursor and all mouse events are
+	/// known to be outside the widget's mouseover rectangle, so no
+	/// mouseover checks are performed.
+	void process(const WidgetEvents & events, bool isHitCandidate = true);
 
 
 	/// returns this widget's parent container.
@@ -351,6 +376,10 @@ private:
 	/// within the widget's mouseover/click area.
 	virtual bool checkMouseover(sf::Vector2f pos) const;
 
+	/// returns a local rectangle containing all positions for which
+	/// checkMouseover() returns true. returns the base rectangle by default.
+	virtual sf::FloatRect getMouseoverRect() const;
+
 	/// returns one of the parent application's loaded fonts.
 	//virtual std::shared_ptr<const btx::Font> onGetFont(int index) const;
 
@@ -376,6 +405,11 @@ private:
 	// converts a mouse button to a unique bitmask.
 	static MouseBitmask convertMouseButtonBitmask(Input button);
 
+	// returns the inverse of the specified transform, only recomputing it if
+	// the transform differs from the cached one.
+	static const sf::Transform & getCachedInverse(const sf::Transform & transform, sf::Transform & cachedTransform,
+			sf::Transform & cachedInverse);
+
 
 	// widget position.
 	sf::Vector2f myPosition;
@@ -415,12 +449,19 @@ private:
 	mutable sf::Transform myTransform, myInverseTransform;
 	mutable bool myIsTransformInvalid, myIsInverseTransformInvalid;
 
+	// the absolute transformation this widget was last processed with, and its inverse.
+	sf::Transform myProcessTransform, myProcessInverseTransform;
+
 	// true if vertex cache needs updating.
 	bool myIsVertexCacheInvalid;
 
 	// pointer to this widget's parent.
 	std::weak_ptr<Container> myParent;
 
+	// index of this widget in its parent's widget vector. only valid while
+	// the widget is within a container.
+	std::size_t myContainerIndex;
+
 
 	friend class Interface;
 	friend class Container;
@@ -171,5 +171,10 @@ bool Cursor::checkMouseover(sf::Vector2f pos) const
 	return false;
 }
 
+sf::FloatRect Cursor::getMouseoverRect() const
+{
+	return sf::FloatRect();
+}
+
 
 } // namespace gui2
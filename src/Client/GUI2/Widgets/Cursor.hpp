@@ -43,6 +43,7 @@ private:
 	void onUpdateVertexCache();
 
 	bool checkMouseover(sf::Vector2f pos) const;
+	sf::FloatRect getMouseoverRect() const;
 
 	sf::Transformable myCursorTransform;
 	sf::FloatRect myTextureRect;
@@ -1,4 +1,5 @@
 #include "Client/GUI2/Widgets/Image.hpp"
+#include "Shared/Utils/Profiler.hpp"
 
 using namespace gui2;
 
@@ -15,6 +16,7 @@ void Image::setTexture(const sf::Texture * tex)
 	{
 		myTexture = tex;
 		update();
+		invalidateRender();
 	}
 }
 
@@ -48,6 +50,7 @@ void Image::onDraw(sf::RenderTarget & target, sf::RenderStates states) const
 		spr.setTexture(*getTexture(), true);
 		spr.setScale(getSize().x / getTexture()->getSize().x, getSize().y / getTexture()->getSize().y);
 		target.draw(spr, states);
+		Profiler::count("GUI draw calls", 1);
 	}
 }
 
@@ -0,0 +1,120 @@
+#include "Client/GUI2/Widgets/MemoryOverlay.hpp"
+
+namespace gui2
+{
+
+static const float textPadding = 4.f;
+
+Ptr<MemoryOverlay> MemoryOverlay::make()
+{
+	Ptr<MemoryOverlay> widget = std::make_shared<MemoryOverlay>();
+	widget->init();
+	return widget;
+}
+
+void MemoryOverlay::setSource(SourceFunc source)
+{
+	mySource = source;
+	refresh();
+}
+
+void MemoryOverlay::setRefreshInterval(sf::Time interval)
+{
+	myRefreshInterval = interval;
+}
+
+sf::Time MemoryOverlay::getRefreshInterval() const
+{
+	return myRefreshInterval;
+}
+
+void MemoryOverlay::refresh()
+{
+	myUsage.clear();
+
+	if (mySource)
+	{
+		mySource(myUsage);
+	}
+
+	myRefreshClock.restart();
+	updateText();
+}
+
+const MemoryUsage & MemoryOverlay::getMemoryUsage() const
+{
+	return myUsage;
+}
+
+void MemoryOverlay::init()
+{
+	Widget::init();
+
+	myRefreshInterval = sf::seconds(1.f);
+
+	setEnabled(false);
+	updateText();
+}
+
+void MemoryOverlay::onProcess(const WidgetEvents & events)
+{
+	// collecting memory usage walks every level and widget, so only do it while the summary is shown.
+	if (isVisible() && myRefreshClock.getElapsedTime() >= myRefreshInterval)
+	{
+		refresh();
+	}
+	else if (!myText.hasFont())
+	{
+		updateText();
+	}
+
+	// wake up for the next refresh while shown, even if nothing else changes.
+	if (isVisible())
+	{
+		requestUpdate(myRefreshInterval - myRefreshClock.getElapsedTime());
+	}
+}
+
+void MemoryOverlay::onUpdateVertexCache()
+{
+	clearVertices();
+	vertexAddRect(sf::FloatRect(0.f, 0.f, getSize().x, getSize().y), sf::Color(0, 0, 0, 180));
+	vertexAddTextured(myText.getVertices());
+}
+
+void MemoryOverlay::onUpdateFonts()
+{
+	myText.setFont(nullptr);
+	updateText();
+}
+
+void MemoryOverlay::updateText()
+{
+	if (!myText.hasFont())
+	{
+		myText.setFont(getDefaultFont());
+	}
+
+	if (!myText.hasFont())
+	{
+		return;
+	}
+
+	std::string text = formatMemoryUsage(myUsage);
+
+	// remove trailing line break.
+	if (!text.empty() && text.back() == '\n')
+	{
+		text.pop_back();
+	}
+
+	myText.setText(text);
+	myText.setColor(sf::Color::White);
+	myText.setPosition(textPadding, textPadding);
+	myText.updateMinor();
+
+	setSize(myText.getWidth() + textPadding * 2.f, myText.getHeight() + textPadding * 2.f);
+	invalidateVertices();
+}
+
+} // namespace gui2
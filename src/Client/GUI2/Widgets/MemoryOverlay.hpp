@@ -0,0 +1,67 @@
+#ifndef GUI2_MEMORY_OVERLAY_HPP
+#define GUI2_MEMORY_OVERLAY_HPP
+
+#include "Client/GUI2/Widget.hpp"
+#include "Shared/Utils/MemoryUsage.hpp"
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <functional>
+
+namespace gui2
+{
+
+/**
+ * displays a summary of estimated memory usage: the total, the usage of each top-level group and the largest
+ * individual entries.
+ *
+ * the memory usage is collected by a user-provided source function, which is called periodically while the widget is
+ * visible. the widget resizes itself to fit the summary.
+ */
+class MemoryOverlay : public Widget
+{
+public:
+
+	typedef std::function<void(MemoryUsage &)> SourceFunc;
+
+	/// factory function.
+	static Ptr<MemoryOverlay> make();
+
+	/// sets the function used to collect memory usage.
+	void setSource(SourceFunc source);
+
+	/// sets/gets the time between two refreshes.
+	void setRefreshInterval(sf::Time interval);
+	sf::Time getRefreshInterval() const;
+
+	/// collects memory usage and updates the summary immediately.
+	void refresh();
+
+	/// returns the most recently collected memory usage.
+	const MemoryUsage & getMemoryUsage() const;
+
+protected:
+
+	virtual void init() override;
+
+private:
+
+	void onProcess(const WidgetEvents & events) override;
+	void onUpdateVertexCache() override;
+	void onUpdateFonts() override;
+
+	// rebuilds the text from the current memory usage and resizes the widget.
+	void updateText();
+
+	BitmapText myText;
+
+	SourceFunc mySource;
+	MemoryUsage myUsage;
+
+	sf::Clock myRefreshClock;
+	sf::Time myRefreshInterval;
+};
+
+} // namespace gui2
+
+#endif
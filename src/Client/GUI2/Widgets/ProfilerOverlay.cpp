@@ -0,0 +1,201 @@
+#include "Client/GUI2/Widgets/ProfilerOverlay.hpp"
+#include "Client/GUI2/Application.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace gui2
+{
+
+static const float tablePadding = 4.f;
+static const float columnSpacing = 8.f;
+static const float histogramBarWidth = 3.f;
+
+Ptr<ProfilerOverlay> ProfilerOverlay::make()
+{
+	Ptr<ProfilerOverlay> widget = std::make_shared<ProfilerOverlay>();
+	widget->init();
+	return widget;
+}
+
+void ProfilerOverlay::init()
+{
+	Widget::init();
+
+	myHistogramOffset = 0.f;
+
+	setEnabled(false);
+	updateTable();
+}
+
+void ProfilerOverlay::onProcess(const WidgetEvents & events)
+{
+	if (Profiler::getStatisticsIndex() != myStatistics.index)
+	{
+		myStatistics = Profiler::getStatistics();
+		updateTable();
+	}
+	else if (!myColumns[ColumnName].hasFont())
+	{
+		updateTable();
+	}
+}
+
+void ProfilerOverlay::onUpdateVertexCache()
+{
+	clearVertices();
+	vertexAddRect(sf::FloatRect(0.f, 0.f, getSize().x, getSize().y), sf::Color(0, 0, 0, 180));
+
+	for (const BitmapText & column : myColumns)
+	{
+		vertexAddTextured(column.getVertices());
+	}
+
+	// one histogram per zone, scaled to the zone's most frequent bucket.
+	float rowHeight = getRowHeight();
+	float barAreaHeight = std::max(rowHeight - 2.f, 1.f);
+
+	for (std::size_t row = 0; row < myStatistics.zones.size(); ++row)
+	{
+		const Profiler::ZoneStatistics & zone = myStatistics.zones[row];
+		std::size_t maxCount = *std::max_element(zone.histogram.begin(), zone.histogram.end());
+
+		float rowBottom = tablePadding + rowHeight * (row + 2) - 1.f;
+
+		for (std::size_t bucket = 0; bucket < Profiler::HistogramBucketCount && maxCount > 0; ++bucket)
+		{
+			float height = barAreaHeight * zone.histogram[bucket] / maxCount;
+			float left = myHistogramOffset + bucket * histogramBarWidth;
+
+			vertexAddRect(sf::FloatRect(left, rowBottom - barAreaHeight, histogramBarWidth - 1.f, barAreaHeight),
+					sf::Color(255, 255, 255, 30));
+
+			if (zone.histogram[bucket] > 0)
+			{
+				vertexAddRect(sf::FloatRect(left, rowBottom - height, histogramBarWidth - 1.f, height),
+						sf::Color(120, 200, 255));
+			}
+		}
+	}
+}
+
+void ProfilerOverlay::onUpdateFonts()
+{
+	for (BitmapText & column : myColumns)
+	{
+		column.setFont(nullptr);
+	}
+
+	updateTable();
+}
+
+void ProfilerOverlay::updateTable()
+{
+	std::array<std::string, ColumnCount> texts = {{ "zone", "ms/frame", "calls/frame", "avg us", "max ms" }};
+
+	float frames = std::max<float>(myStatistics.frameCount, 1);
+	char buffer[32];
+
+	for (const Profiler::ZoneStatistics & zone : myStatistics.zones)
+	{
+		texts[ColumnName] += "\n" + zone.name;
+
+		std::snprintf(buffer, sizeof(buffer), "\n%.3f", zone.totalTime.asSeconds() * 1000.f / frames);
+		texts[ColumnFrameTime] += buffer;
+
+		std::snprintf(buffer, sizeof(buffer), "\n%.1f", zone.calls / frames);
+		texts[ColumnCalls] += buffer;
+
+		std::snprintf(buffer, sizeof(buffer), "\n%.1f",
+				zone.calls == 0 ? 0.f : float(zone.totalTime.asMicroseconds()) / zone.calls);
+		texts[ColumnAverage] += buffer;
+
+		std::snprintf(buffer, sizeof(buffer), "\n%.3f", zone.maxTime.asSeconds() * 1000.f);
+		texts[ColumnMaximum] += buffer;
+	}
+
+	// counters follow the zones with their own header row.
+	if (!myStatistics.counters.empty())
+	{
+		texts[ColumnName] += "\ncounter";
+		texts[ColumnFrameTime] += "\nper frame";
+		texts[ColumnCalls] += "\nmax/frame";
+		texts[ColumnAverage] += "\n";
+		texts[ColumnMaximum] += "\n";
+
+		for (const Profiler::CounterStatistics & counter : myStatistics.counters)
+		{
+			texts[ColumnName] += "\n" + counter.name;
+
+			std::snprintf(buffer, sizeof(buffer), "\n%.1f", counter.total / frames);
+			texts[ColumnFrameTime] += buffer;
+
+			std::snprintf(buffer, sizeof(buffer), "\n%lld", static_cast<long long>(counter.maxPerFrame));
+			texts[ColumnCalls] += buffer;
+		}
+	}
+
+	if (myStatistics.frameTime > sf::Time::Zero)
+	{
+		std::snprintf(buffer, sizeof(buffer), "\n(%.1f fps)",
+				myStatistics.frameCount / myStatistics.frameTime.asSeconds());
+		texts[ColumnName] += buffer;
+
+		// in event-driven mode, the framerate alone does not show how busy the application is.
+		std::shared_ptr<Interface> interface = getParentInterface();
+		if (interface)
+		{
+			std::snprintf(buffer, sizeof(buffer), "\n(%.1f%% cpu, %.1f%% idle)",
+					interface->getParentApplication().getCpuUsage() * 100.f,
+					interface->getParentApplication().getIdleRatio() * 100.f);
+			texts[ColumnFrameTime] += buffer;
+		}
+	}
+
+	float offset = tablePadding;
+	float height = 0.f;
+
+	for (std::size_t i = 0; i < ColumnCount; ++i)
+	{
+		BitmapText & column = myColumns[i];
+
+		if (!column.hasFont())
+		{
+			column.setFont(getDefaultFont());
+		}
+
+		if (!column.hasFont())
+		{
+			return;
+		}
+
+		column.setText(texts[i]);
+		column.setColor(i == ColumnName ? sf::Color(255, 255, 160) : sf::Color::White);
+		column.setPosition(offset, tablePadding);
+		column.updateMinor();
+
+		offset += column.getWidth() + columnSpacing;
+		height = std::max(height, column.getHeight());
+	}
+
+	myHistogramOffset = offset;
+	offset += Profiler::HistogramBucketCount * histogramBarWidth;
+
+	setSize(offset + tablePadding, height + tablePadding * 2.f);
+	invalidateVertices();
+}
+
+float ProfilerOverlay::getRowHeight() const
+{
+	// the header, counter and fps lines are included in the name column.
+	std::size_t lineCount = myStatistics.zones.size() + (myStatistics.frameTime > sf::Time::Zero ? 2 : 1);
+
+	if (!myStatistics.counters.empty())
+	{
+		lineCount += myStatistics.counters.size() + 1;
+	}
+
+	return myColumns[ColumnName].getHeight() / lineCount;
+}
+
+} // namespace gui2
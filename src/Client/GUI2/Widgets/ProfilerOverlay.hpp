@@ -0,0 +1,62 @@
+#ifndef GUI2_PROFILER_OVERLAY_HPP
+#define GUI2_PROFILER_OVERLAY_HPP
+
+#include "Client/GUI2/Widget.hpp"
+#include "Shared/Utils/Profiler.hpp"
+
+#include <array>
+
+namespace gui2
+{
+
+/**
+ * displays the profiler's zone statistics as a table: time per frame, calls per frame, average and maximum time per
+ * call, followed by a histogram of call durations for each zone. counters are listed below the zones with their
+ * average and maximum value per frame.
+ *
+ * the widget resizes itself to fit the table and refreshes whenever the profiler publishes new statistics.
+ * recording must be enabled separately using Profiler::setEnabled().
+ */
+class ProfilerOverlay : public Widget
+{
+public:
+
+	/// factory function.
+	static Ptr<ProfilerOverlay> make();
+
+protected:
+
+	virtual void init() override;
+
+private:
+
+	enum Column
+	{
+		ColumnName,
+		ColumnFrameTime,
+		ColumnCalls,
+		ColumnAverage,
+		ColumnMaximum,
+
+		ColumnCount
+	};
+
+	void onProcess(const WidgetEvents & events) override;
+	void onUpdateVertexCache() override;
+	void onUpdateFonts() override;
+
+	// rebuilds the column texts from the current statistics and resizes the widget.
+	void updateTable();
+
+	// returns the height of a single table row.
+	float getRowHeight() const;
+
+	std::array<BitmapText, ColumnCount> myColumns;
+	float myHistogramOffset;
+
+	Profiler::Statistics myStatistics;
+};
+
+} // namespace gui2
+
+#endif
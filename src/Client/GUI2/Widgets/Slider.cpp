@@ -203,6 +203,10 @@ void Slider::onProcess(const WidgetEvents & events)
 			setTextColor(sf::Color(255, 255, 255, fadeOut * 255));
 			invalidateVertices();
 		}
+
+		// keep fading out without further input.
+		if (!isAlwaysDisplayingText() && fadeOut > 0.f)
+			requestUpdate();
 	}
 }
 
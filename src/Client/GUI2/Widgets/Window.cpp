@@ -635,6 +635,15 @@ bool Window::checkMouseover(sf::Vector2f pos) const
 	if (isMaximized())
 		return true;
 
+	return getMouseoverRect().contains(pos);
+}
+
+sf::FloatRect Window::getMouseoverRect() const
+{
+	// maximized windows cover the parent's whole container area.
+	if (isMaximized() && getParent())
+		return getInverseTransform().transformRect(getParent()->getContainerBoundingBox());
+
 	sf::FloatRect rect = getBaseRect();
 
 	rect.left   -= cvBorderThickness;
@@ -650,7 +659,7 @@ bool Window::checkMouseover(sf::Vector2f pos) const
 			rect.top += cvBorderThickness + cvTitleBarHeight;
 	}
 
-	return rect.contains(pos);
+	return rect;
 }
 
 void Window::onProcessWindow(const WidgetEvents & events)
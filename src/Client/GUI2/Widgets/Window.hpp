@@ -84,6 +84,7 @@ private:
 	void onUpdateVertexCachePrepend();
 	void onUpdateVertexCacheAppend();
 	bool checkMouseover(sf::Vector2f pos) const;
+	sf::FloatRect getMouseoverRect() const;
 
 	/// called whenever the window is processed.
 	virtual void onProcessWindow(const WidgetEvents & events);
@@ -253,6 +253,18 @@ bool Input::operator< (const Input & rhs) const
 	return getDataNum() < rhs.getDataNum();
 }
 
+DataStream & operator<<(DataStream & strm, const Input & key)
+{
+	return strm << key.getDataNum();
+}
+DataStream & operator>>(DataStream & strm, Input & key)
+{
+	sf::Int32 data = 0;
+	strm >> data;
+	key.setDataNum(data);
+	return strm;
+}
+
 InputGroup::InputGroup()
 {
 }
@@ -329,6 +341,28 @@ bool InputGroup::containsOnly(const InputGroup & input) const
 	return containsAllOf(input) && input.getKeyCount() == getKeyCount();
 }
 
+DataStream & operator<<(DataStream & strm, const InputGroup & keyGroup)
+{
+	strm << sf::Uint32(keyGroup.getKeyCount());
+	for (unsigned int i = 0; i < keyGroup.getKeyCount(); ++i)
+		strm << keyGroup.get(i);
+	return strm;
+}
+DataStream & operator>>(DataStream & strm, InputGroup & keyGroup)
+{
+	sf::Uint32 count = 0;
+	strm >> count;
+
+	keyGroup.clear();
+	for (sf::Uint32 i = 0; i < count && strm.hasMoreData(); ++i)
+	{
+		Input key;
+		strm >> key;
+		keyGroup.add(key);
+	}
+	return strm;
+}
+
 void InputProcessor::reset()
 {
 	myPressedKeys.clear();
@@ -110,6 +110,8 @@ BitmapText::BitmapText()
 	myShadowOffset = 0;
 	//myFont = nullptr;
 	myVertexCacheNeedUpdate = false;
+	myLayoutStyle = LayoutStyle();
+	myLayoutLength = 0;
 	//myTabInfo = 0;
 }
 
@@ -118,6 +120,7 @@ void BitmapText::setFont(std::shared_ptr<const BitmapFont> font)
 	if (myFont.lock() != font)
 	{
 		myFont = font;
+		myLayoutLength = 0;
 		update();
 	}
 }
@@ -137,7 +140,13 @@ void BitmapText::setText(std::string text)
 {
 	if (myString != text)
 	{
-		myString = text;
+		// characters before the first change keep their layout, except for the last 3 characters of the old text,
+		// as escape code parsing depends on the text length.
+		std::size_t minLength = std::min(myString.length(), text.length());
+		std::size_t unchanged = std::mismatch(text.begin(), text.begin() + minLength, myString.begin()).first - text.begin();
+		myLayoutLength = std::min({ myLayoutLength, unchanged, minLength < 3 ? 0 : minLength - 3 });
+
+		myString = std::move(text);
 		update();
 	}
 }
@@ -453,9 +462,9 @@ sf::Color BitmapText::getCharacterColorB(std::size_t pos) const
 
 float BitmapText::getRawGlyphWidth(std::size_t pos) const
 {
-	if (!hasFont() || pos >= getText().length()) return 0;
+	if (!hasFont() || pos >= myString.length()) return 0;
 
-	int arrPos = (unsigned char)(getText()[pos]) - (unsigned char)getFont().charFirst;
+	int arrPos = (unsigned char)(myString[pos]) - (unsigned char)getFont().charFirst;
 
 	if (arrPos >= 0 && arrPos < (int)getFont().cwidth.size())
 		return getFont().cwidth[arrPos];
@@ -502,35 +511,63 @@ void BitmapText::update()
 {
 	if (!hasFont()) return;
 
-	myVertices.clear();
-
 	myMaxSizeScale = sf::Vector2f(1,1);
 
-	sf::Vector2f charPos(0,0), charSize(0,getFont().height * getFont().scale), texPos(0,0), texSize(0,0), nextOff(0,0);
-	sf::Color curColor = getColor();
-	bool bold = false, italic = false, newline = false;
+	LayoutStyle style = getLayoutStyle();
+	if (!(style == myLayoutStyle))
+	{
+		myLayoutStyle = style;
+		myLayoutLength = 0;
+	}
 
-	enum EscapeMode
+	// skip layout entirely if neither text nor style changed.
+	if (myLayoutLength >= myString.length() && myGlyphVertices.size() == myString.length() * numVertices)
 	{
-		EscapeNone,
-		EscapeHash,
-		EscapeHexRed,
-		EscapeHexGreen,
-		EscapeHexBlue
+		updateMinorImpl();
+		return;
 	}
-	escapeMode = EscapeNone;
 
-	myCharRenderMap.resize(getText().length());
+	// resume at the start of the first line affected by the change.
+	while (!myLineStates.empty() && myLineStates.back().index > myLayoutLength)
+		myLineStates.pop_back();
 
-	for (std::size_t i = 0; i < getText().length(); ++i)
+	LayoutState state;
+	if (myLineStates.empty())
+	{
+		state.index = 0;
+		state.color = getColor();
+		state.bold = false;
+		state.italic = false;
+		state.escapeMode = EscapeNone;
+	}
+	else
 	{
+		state = myLineStates.back();
+		myLineStates.pop_back();
+	}
+
+	myGlyphVertices.resize(state.index * numVertices);
+
+	sf::Vector2f charSize(0,getFont().height * getFont().scale), nextOff(0,0);
+	sf::Vector2f & charPos = state.charPos, & texPos = state.texPos, & texSize = state.texSize;
+	sf::Color & curColor = state.color;
+	bool & bold = state.bold, & italic = state.italic, newline = false;
+	EscapeMode & escapeMode = state.escapeMode;
+
+	myCharRenderMap.resize(myString.length());
+
+	for (std::size_t i = state.index; i < myString.length(); ++i)
+	{
+		LayoutState charState = state;
+		charState.index = i;
+
 		charSize.x = 0;
 
-		unsigned int chr = (unsigned char)getText()[i];
+		unsigned int chr = (unsigned char)myString[i];
 
 		myCharRenderMap[i] = escapeMode == EscapeNone;
 
-		if (isParsingModifers() && chr == formatChar && escapeMode != EscapeHash && i < getText().length() -1)
+		if (isParsingModifers() && chr == formatChar && escapeMode != EscapeHash && i < myString.length() -1)
 		{
 			escapeMode = EscapeHash;
 			myCharRenderMap[i] = false;
@@ -546,7 +583,7 @@ void BitmapText::update()
 				italic = false;
 				curColor = getColor();
 			}
-			else if (chr == '*' && i < getText().length() -3)
+			else if (chr == '*' && i < myString.length() -3)
 			{										   // custom color determined by 3 hex digits.
 				escapeMode = EscapeHexRed;
 			}
@@ -602,6 +639,9 @@ void BitmapText::update()
 			newline = false;
 			charPos.x = 0;
 			charPos.y += (getFont().height + getSpacing().y) * getFont().scale;
+
+			// later edits can resume layout from this character.
+			myLineStates.push_back(charState);
 		}
 
 		curColor.a = getColor().a;  // keep alpha value from original color.
@@ -618,49 +658,51 @@ void BitmapText::update()
 		vBR (sf::Vector2f(charPos.x+charSize.x, charPos.y+charSize.y), curColor * colMul, sf::Vector2f(texPos.x+texSize.x,texPos.y+texSize.y)),
 		vBL (sf::Vector2f(charPos.x,charPos.y+charSize.y), curColor * colMul, sf::Vector2f(texPos.x,texPos.y+texSize.y));
 
-		myVertices.append(vTL);
-		myVertices.append(vTR);
-		myVertices.append(vBL);
+		myGlyphVertices.push_back(vTL);
+		myGlyphVertices.push_back(vTR);
+		myGlyphVertices.push_back(vBL);
 
-		myVertices.append(vTR);
-		myVertices.append(vBR);
-		myVertices.append(vBL);
+		myGlyphVertices.push_back(vTR);
+		myGlyphVertices.push_back(vBR);
+		myGlyphVertices.push_back(vBL);
 
 		if (italic)
 		{
-			myVertices[myVertices.getVertexCount()-1].position.x -= 1.5f;
-			myVertices[myVertices.getVertexCount()-2].position.x -= 1.5f;
-			myVertices[myVertices.getVertexCount()-3].position.x += 1.5f;
-			myVertices[myVertices.getVertexCount()-4].position.x -= 1.5f;
-			myVertices[myVertices.getVertexCount()-5].position.x += 1.5f;
-			myVertices[myVertices.getVertexCount()-6].position.x += 1.5f;
+			myGlyphVertices[myGlyphVertices.size()-1].position.x -= 1.5f;
+			myGlyphVertices[myGlyphVertices.size()-2].position.x -= 1.5f;
+			myGlyphVertices[myGlyphVertices.size()-3].position.x += 1.5f;
+			myGlyphVertices[myGlyphVertices.size()-4].position.x -= 1.5f;
+			myGlyphVertices[myGlyphVertices.size()-5].position.x += 1.5f;
+			myGlyphVertices[myGlyphVertices.size()-6].position.x += 1.5f;
 		}
 
 		charPos += nextOff;
 		nextOff = sf::Vector2f(0,0);
 	}
 
+	myLayoutLength = myString.length();
+
 	// reset max size when recalculating text vertices.
 	myMaxSizeScale.x = 1.f;
 	myMaxSizeScale.y = 1.f;
 
-	// allocate vertices for shadow.
-	myShadowOffset = myVertices.getVertexCount();
+	// shadow vertices come first, followed by the glyphs.
+	myShadowOffset = myGlyphVertices.size();
+	myVertices.resize(myShadowOffset * 2);
+
 	for (std::size_t i = 0; i < myShadowOffset; ++i)
-		myVertices.append(myVertices[i]);
+	{
+		myVertices[i].position = myGlyphVertices[i].position + sf::Vector2f(1,1);	 // offset shadow by 1,1.
+		myVertices[i].color = sf::Color(0,0,0,myGlyphVertices[i].color.a/2);		  // semi-transparent.
+		myVertices[i].texCoords = myGlyphVertices[i].texCoords;
+		myVertices[myShadowOffset+i] = myGlyphVertices[i];
+	}
 
 	// calculate bounds.
 	sf::FloatRect vertBounds = calculateBounds();
 	mySize.x = vertBounds.width;
 	mySize.y = vertBounds.height;
 
-	// shadow.
-	for (std::size_t i = 0; i < myShadowOffset; ++i)
-	{
-		myVertices[i].position = myVertices[myShadowOffset+i].position + sf::Vector2f(1,1);	 // offset shadow by 1,1.
-		myVertices[i].color = sf::Color(0,0,0,myVertices[myShadowOffset+i].color.a/2);		  // semi-transparent.
-	}
-
 	updateMinorImpl();
 }
 
@@ -823,6 +865,23 @@ sf::FloatRect BitmapText::calculateBounds() const
 }
 
 
+bool BitmapText::LayoutStyle::operator==(const LayoutStyle & style) const
+{
+	return font == style.font && color == style.color && spacing == style.spacing
+		&& parseModifiers == style.parseModifiers && wrapWidth == style.wrapWidth;
+}
+
+BitmapText::LayoutStyle BitmapText::getLayoutStyle() const
+{
+	LayoutStyle style;
+	style.font = hasFont() ? &getFont() : nullptr;
+	style.color = getColor();
+	style.spacing = getSpacing();
+	style.parseModifiers = isParsingModifers();
+	style.wrapWidth = getMaxSizeBehavior() == WordWrap && getMaxSize().x > 0 ? getMaxSize().x : 0.f;
+	return style;
+}
+
 bool BitmapText::isCharacterRendered(std::size_t pos) const
 {
 	if (pos >= myCharRenderMap.size())
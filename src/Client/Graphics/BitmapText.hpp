@@ -132,7 +132,7 @@ public:
 	float getGlyphOffset(std::size_t pos) const;	/// return horizontal offset of the character at the given position.
 	sf::Vector2f getCharacterSize(std::size_t pos) const;/// return size of a given character in the string, including its offset.
 
-	void update();							  /// update vertices and size bounds.
+	void update();							  /// update vertices and size bounds. only relayouts lines changed since the last update.
 	void updateMinor();						 /// update size bounds and shadow only.
 
 	const std::vector<sf::Vertex> & getVertices() const;	/// returns this text's vertices.
@@ -158,8 +158,46 @@ private:
 	/// is this character visibly rendered?
 	bool isCharacterRendered(std::size_t pos) const;
 
+	enum EscapeMode
+	{
+		EscapeNone,
+		EscapeHash,
+		EscapeHexRed,
+		EscapeHexGreen,
+		EscapeHexBlue
+	};
+
+	/// parser and layout state before processing a character.
+	struct LayoutState
+	{
+		std::size_t index;
+		sf::Vector2f charPos, texPos, texSize;
+		sf::Color color;
+		bool bold, italic;
+		EscapeMode escapeMode;
+	};
+
+	/// properties the layout depends on, apart from the text itself.
+	struct LayoutStyle
+	{
+		const BitmapFont * font;
+		sf::Color color;
+		sf::Vector2f spacing;
+		bool parseModifiers;
+		float wrapWidth;
+
+		bool operator==(const LayoutStyle & style) const;
+	};
+
+	LayoutStyle getLayoutStyle() const;
+
 	sf::VertexArray myVertices;
 
+	std::vector<sf::Vertex> myGlyphVertices;  /// laid out glyphs, without shadow.
+	std::vector<LayoutState> myLineStates;	/// state at the first character of each line after the first.
+	LayoutStyle myLayoutStyle;				/// style used for the current layout.
+	std::size_t myLayoutLength;			   /// number of leading characters whose layout is up to date.
+
 	mutable std::vector<sf::Vertex> myVertexCache;
 	mutable bool myVertexCacheNeedUpdate;
 
@@ -21,5 +21,9 @@ bool ITexturePacker::isSmooth() const
 	return getTexture()->isSmooth();
 }
 
+void ITexturePacker::getMemoryUsage(MemoryUsage & usage) const
+{
+}
+
 
 
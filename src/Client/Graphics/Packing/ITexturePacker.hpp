@@ -12,6 +12,8 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <memory>
 
+class MemoryUsage;
+
 namespace sf
 {
 class Image;
@@ -45,6 +47,8 @@ public:
 
 	virtual void setSmooth(bool smooth) = 0;
 	bool isSmooth() const;
+
+	virtual void getMemoryUsage(MemoryUsage & usage) const;
 };
 
 
@@ -9,6 +9,7 @@
 #include <Client/Graphics/Packing/TexturePacker.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <Shared/Utils/MakeUnique.hpp>
+#include <Shared/Utils/MemoryUsage.hpp>
 #include <algorithm>
 
 namespace priv
@@ -125,3 +126,17 @@ void SortingTexturePacker::setSmooth(bool smooth)
 {
 	myPacker->setSmooth(smooth);
 }
+
+void SortingTexturePacker::getMemoryUsage(MemoryUsage & usage) const
+{
+	myPacker->getMemoryUsage(usage);
+
+	std::size_t queuedBytes = MemoryUsage::getVectorBytes(myImageQueue);
+	for (const QueuedImage & queued : myImageQueue)
+	{
+		queuedBytes += sizeof(sf::Image) + std::size_t(queued.image->getSize().x) * queued.image->getSize().y * 4;
+	}
+
+	usage.add("queued images", queuedBytes, myImageQueue.size());
+	usage.add("node mapping", MemoryUsage::getVectorBytes(myNodeMapping), myNodeMapping.size());
+}
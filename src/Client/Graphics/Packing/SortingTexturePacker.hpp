@@ -40,6 +40,8 @@ public:
 
 	void setSmooth(bool smooth) override;
 
+	void getMemoryUsage(MemoryUsage & usage) const override;
+
 private:
 
 	struct QueuedImage
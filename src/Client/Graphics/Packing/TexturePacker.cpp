@@ -10,6 +10,7 @@
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <Shared/Utils/MakeUnique.hpp>
+#include <Shared/Utils/MemoryUsage.hpp>
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
@@ -149,6 +150,17 @@ void TexturePacker::setSmooth(bool smooth)
 	myTexture->setSmooth(smooth);
 }
 
+void TexturePacker::getMemoryUsage(MemoryUsage & usage) const
+{
+	// the texture itself lives in video memory, 4 bytes per pixel.
+	sf::Vector2u size = myTexture->getSize();
+	usage.add("texture", std::size_t(size.x) * size.y * 4, 1);
+
+	std::size_t nodeCount = myTree ? myTree->getNodeCount() : 0;
+	usage.add("packing nodes", nodeCount * (sizeof(Node) + MemoryUsage::SharedOverhead), nodeCount);
+	usage.add("lookup table", MemoryUsage::getVectorBytes(myLookupTable), myLookupTable.size());
+}
+
 bool TexturePacker::createTransparentTexture(sf::Vector2u size)
 {
 	if (!myTexture->create(size.x, size.y))
@@ -322,5 +334,10 @@ sf::Vector2u TexturePacker::Node::getSizeBounds(sf::Vector2u currentMax) const
 	return currentMax;
 }
 
+std::size_t TexturePacker::Node::getNodeCount() const
+{
+	return 1 + (sub1 ? sub1->getNodeCount() : 0) + (sub2 ? sub2->getNodeCount() : 0);
+}
+
 
 
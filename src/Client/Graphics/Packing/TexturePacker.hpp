@@ -33,6 +33,8 @@ public:
 
 	void setSmooth(bool smooth) override;
 
+	void getMemoryUsage(MemoryUsage & usage) const override;
+
 	void setMinimumTextureSize(sf::Vector2u minimumSize);
 	sf::Vector2u getMinimumTextureSize() const;
 
@@ -51,6 +53,7 @@ private:
 
 		std::shared_ptr<Node> add(const sf::Image & image, sf::Vector2u maxSize);
 		sf::Vector2u getSizeBounds(sf::Vector2u currentMax = sf::Vector2u()) const;
+		std::size_t getNodeCount() const;
 	};
 
 	bool createTransparentTexture(sf::Vector2u size);
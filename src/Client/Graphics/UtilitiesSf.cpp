@@ -113,6 +113,22 @@ void drawClipped(const sf::Drawable & drawable, sf::RenderTarget & target, sf::R
 	}
 }
 
+bool suspendClipping()
+{
+	if (glIsEnabled(GL_SCISSOR_TEST))
+	{
+		glDisable(GL_SCISSOR_TEST);
+		return true;
+	}
+	return false;
+}
+
+void resumeClipping(bool wasClipping)
+{
+	if (wasClipping)
+		glEnable(GL_SCISSOR_TEST);
+}
+
 namespace priv
 {
 
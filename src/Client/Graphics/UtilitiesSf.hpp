@@ -41,6 +41,13 @@ inline void drawClipped(const sf::Drawable & drawable, sf::RenderTarget & target
 	drawClipped(drawable, target, states, sf::IntRect(clipRect));
 }
 
+/// disables the clipping rectangle of drawClipped() in the active context, so drawing to a render texture while a
+/// parent is clipped is unaffected. returns true if clipping was enabled.
+bool suspendClipping();
+
+/// restores the clipping state returned by suspendClipping().
+void resumeClipping(bool wasClipping);
+
 void clipVertices(std::vector<sf::Vertex> & vertices, const sf::FloatRect & clipRect);
 void clipVertices(std::vector<sf::Vertex> & vertices, std::size_t startPos, std::size_t endPos, const sf::FloatRect & clipRect);
 void clipVertices(sf::VertexArray & array, const sf::FloatRect & clipRect);
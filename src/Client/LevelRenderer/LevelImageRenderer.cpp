@@ -0,0 +1,155 @@
+#include <Client/LevelRenderer/LevelImageRenderer.hpp>
+#include <Client/LevelRenderer/LevelRenderer.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <Shared/Level/Dungeon.hpp>
+#include <Shared/Level/Level.hpp>
+#include <Shared/Utils/Profiler.hpp>
+#include <Shared/Utils/StrNumCon.hpp>
+#include <algorithm>
+#include <cmath>
+
+LevelImageRenderer::LevelImageRenderer(const TileAppearanceManager & tileAppearance,
+		const ObjectAppearanceManager & objectAppearance) :
+		tileAppearance(&tileAppearance),
+		objectAppearance(&objectAppearance),
+		scale(1.f),
+		maximumImageSize(0, 0),
+		maximumPartSize(0),
+		backgroundColor(sf::Color::Transparent)
+{
+}
+
+void LevelImageRenderer::setScale(float scale)
+{
+	this->scale = scale;
+}
+
+float LevelImageRenderer::getScale() const
+{
+	return scale;
+}
+
+void LevelImageRenderer::setMaximumImageSize(sf::Vector2u size)
+{
+	maximumImageSize = size;
+}
+
+sf::Vector2u LevelImageRenderer::getMaximumImageSize() const
+{
+	return maximumImageSize;
+}
+
+void LevelImageRenderer::setMaximumPartSize(unsigned int size)
+{
+	maximumPartSize = size;
+}
+
+unsigned int LevelImageRenderer::getMaximumPartSize() const
+{
+	return maximumPartSize;
+}
+
+void LevelImageRenderer::setBackgroundColor(sf::Color color)
+{
+	backgroundColor = color;
+}
+
+sf::Color LevelImageRenderer::getBackgroundColor() const
+{
+	return backgroundColor;
+}
+
+bool LevelImageRenderer::renderLevel(const Dungeon & dungeon, const Level & level, sf::Image & image) const
+{
+	ProfileZone zone("LevelImageRenderer::renderLevel");
+
+	LevelRenderer renderer(dungeon, level, *tileAppearance, *objectAppearance);
+
+	// Snap the content bounds to whole world pixels to keep sprites aligned with the image grid.
+	sf::FloatRect bounds = renderer.getBounds();
+	float left = std::floor(bounds.left);
+	float top = std::floor(bounds.top);
+	sf::Vector2f worldSize(std::ceil(bounds.left + bounds.width) - left, std::ceil(bounds.top + bounds.height) - top);
+
+	if (worldSize.x <= 0.f || worldSize.y <= 0.f)
+	{
+		image.create(1, 1, backgroundColor);
+		return true;
+	}
+
+	// Shrink oversized levels to fit the maximum image size.
+	float imageScale = scale;
+
+	if (maximumImageSize.x != 0)
+	{
+		imageScale = std::min(imageScale, maximumImageSize.x / worldSize.x);
+	}
+
+	if (maximumImageSize.y != 0)
+	{
+		imageScale = std::min(imageScale, maximumImageSize.y / worldSize.y);
+	}
+
+	sf::Vector2u imageSize(std::max(1.f, std::ceil(worldSize.x * imageScale)),
+		std::max(1.f, std::ceil(worldSize.y * imageScale)));
+
+	unsigned int partSize = sf::Texture::getMaximumSize();
+
+	if (maximumPartSize != 0)
+	{
+		partSize = std::min(partSize, maximumPartSize);
+	}
+
+	sf::RenderTexture texture;
+
+	if (!texture.create(std::min(partSize, imageSize.x), std::min(partSize, imageSize.y)))
+	{
+		return false;
+	}
+
+	sf::Vector2u textureSize = texture.getSize();
+
+	image.create(imageSize.x, imageSize.y, backgroundColor);
+
+	for (unsigned int y = 0; y < imageSize.y; y += textureSize.y)
+	{
+		for (unsigned int x = 0; x < imageSize.x; x += textureSize.x)
+		{
+			texture.setView(sf::View(sf::FloatRect(left + x / imageScale, top + y / imageScale,
+				textureSize.x / imageScale, textureSize.y / imageScale)));
+			texture.clear(backgroundColor);
+			texture.draw(renderer);
+			texture.display();
+
+			sf::IntRect partRect(0, 0, std::min(textureSize.x, imageSize.x - x), std::min(textureSize.y, imageSize.y - y));
+			image.copy(texture.getTexture().copyToImage(), x, y, partRect);
+		}
+	}
+
+	return true;
+}
+
+bool LevelImageRenderer::saveLevel(const Dungeon & dungeon, const Level & level, const std::string & filename) const
+{
+	sf::Image image;
+	return renderLevel(dungeon, level, image) && image.saveToFile(filename);
+}
+
+std::size_t LevelImageRenderer::saveDungeon(const Dungeon & dungeon, const std::string & filenamePrefix) const
+{
+	std::size_t savedCount = 0;
+
+	for (std::size_t i = 0; i < dungeon.getLevelCount(); ++i)
+	{
+		if (saveLevel(dungeon, dungeon.getLevel(i), filenamePrefix + cNtoS(i + 1) + ".png"))
+		{
+			savedCount++;
+		}
+	}
+
+	return savedCount;
+}
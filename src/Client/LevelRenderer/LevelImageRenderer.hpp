@@ -0,0 +1,92 @@
+#ifndef SRC_CLIENT_LEVELRENDERER_LEVELIMAGERENDERER_HPP_
+#define SRC_CLIENT_LEVELRENDERER_LEVELIMAGERENDERER_HPP_
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <string>
+
+class Dungeon;
+class Level;
+class ObjectAppearanceManager;
+class TileAppearanceManager;
+
+namespace sf
+{
+class Image;
+}
+
+/**
+ * Renders levels into images without requiring a window, for example to generate previews or to compare the output of
+ * the level renderer between versions.
+ * 
+ * Levels are drawn using a LevelRenderer on an off-screen render texture. Levels whose image would exceed the maximum
+ * texture size are drawn in several parts and assembled in memory.
+ */
+class LevelImageRenderer
+{
+public:
+
+	/**
+	 * Creates an image renderer using the provided appearance managers. Their texture packer must already be packed.
+	 */
+	LevelImageRenderer(const TileAppearanceManager & tileAppearance, const ObjectAppearanceManager & objectAppearance);
+
+	/**
+	 * Sets the number of image pixels per world pixel. Defaults to 1.
+	 */
+	void setScale(float scale);
+	float getScale() const;
+
+	/**
+	 * Sets the maximum size of the resulting images. Levels that would not fit at the current scale are scaled down
+	 * further, keeping their aspect ratio. A component of 0 means unlimited, which is the default.
+	 */
+	void setMaximumImageSize(sf::Vector2u size);
+	sf::Vector2u getMaximumImageSize() const;
+
+	/**
+	 * Sets the maximum width and height of each render texture part. 0 (the default) uses the largest texture size
+	 * supported by the graphics driver.
+	 */
+	void setMaximumPartSize(unsigned int size);
+	unsigned int getMaximumPartSize() const;
+
+	/**
+	 * Sets the color of areas not covered by tiles or objects. Defaults to transparent.
+	 */
+	void setBackgroundColor(sf::Color color);
+	sf::Color getBackgroundColor() const;
+
+	/**
+	 * Renders the specified level into an image, cropped to the level's content.
+	 * 
+	 * Empty levels result in a 1x1 image filled with the background color. Returns false if the render texture could
+	 * not be created.
+	 */
+	bool renderLevel(const Dungeon & dungeon, const Level & level, sf::Image & image) const;
+
+	/**
+	 * Renders the specified level and saves the result to an image file. The format is chosen by the file extension.
+	 */
+	bool saveLevel(const Dungeon & dungeon, const Level & level, const std::string & filename) const;
+
+	/**
+	 * Renders every level of the dungeon to a PNG file named "<prefix><level number>.png", starting at level 1.
+	 * 
+	 * Returns the number of images that were saved successfully.
+	 */
+	std::size_t saveDungeon(const Dungeon & dungeon, const std::string & filenamePrefix) const;
+
+private:
+
+	const TileAppearanceManager * tileAppearance;
+	const ObjectAppearanceManager * objectAppearance;
+
+	float scale;
+	sf::Vector2u maximumImageSize;
+	unsigned int maximumPartSize;
+	sf::Color backgroundColor;
+};
+
+#endif
@@ -3,8 +3,11 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <Shared/Level/Dungeon.hpp>
 #include <Shared/Level/Tile.hpp>
+#include <Shared/Utils/MemoryUsage.hpp>
+#include <Shared/Utils/Profiler.hpp>
 #include <algorithm>
 #include <iterator>
+#include <limits>
 
 LevelRenderer::LevelRenderer(const Dungeon & dungeon, const Level & level, const TileAppearanceManager & tileAppearance,
 		const ObjectAppearanceManager & objectAppearance) :
@@ -12,7 +15,8 @@ LevelRenderer::LevelRenderer(const Dungeon & dungeon, const Level & level, const
 		level(&level),
 		tileAppearance(&tileAppearance),
 		objectAppearance(&objectAppearance),
-		spawnPointVisualizer(Object::Type::Internal)
+		spawnPointVisualizer(Object::Type::Internal),
+		oldestUndrawnEventTime(-1)
 {
 	eventListener = level.acquireEventListener();
 
@@ -20,7 +24,7 @@ LevelRenderer::LevelRenderer(const Dungeon & dungeon, const Level & level, const
 
 	for (auto it = level.tilesBegin(); it != level.tilesEnd(); ++it)
 	{
-		addOrSetTile(*it, level.getTileAt(*it));
+		addOrSetTile(*it, it.getTile());
 	}
 
 	for (auto it = level.objectsBegin(); it != level.objectsEnd(); ++it)
@@ -35,8 +39,87 @@ LevelRenderer::~LevelRenderer()
 {
 }
 
+void LevelRenderer::getMemoryUsage(MemoryUsage & usage) const
+{
+	for (std::size_t layer = 0; layer < LayerCount; ++layer)
+	{
+		std::size_t vertexBytes = MemoryUsage::getVectorBytes(tileVertices[layer]);
+		std::size_t vertexCount = 0;
+
+		for (const TileVertexArray & vertices : tileVertices[layer])
+		{
+			vertexBytes += MemoryUsage::getVectorBytes(vertices);
+			vertexCount += vertices.size();
+		}
+
+		usage.add("tile vertices", vertexBytes, vertexCount);
+		usage.add("tile positions", MemoryUsage::getVectorBytes(tilePositions[layer]), tilePositions[layer].size());
+	}
+
+	usage.add("object vertices", MemoryUsage::getVectorBytes(objectVertices), objectVertices.size());
+	usage.add("object vertex counts", MemoryUsage::getVectorBytes(objectVertexCounts), objectVertexCounts.size());
+	usage.add("spawn point vertices", MemoryUsage::getVectorBytes(spawnPointVertices), spawnPointVertices.size());
+}
+
+namespace priv
+{
+
+void extendBounds(const std::vector<sf::Vertex> & vertices, sf::Vector2f & topLeft, sf::Vector2f & bottomRight)
+{
+	for (const sf::Vertex & vertex : vertices)
+	{
+		topLeft.x = std::min(topLeft.x, vertex.position.x);
+		topLeft.y = std::min(topLeft.y, vertex.position.y);
+		bottomRight.x = std::max(bottomRight.x, vertex.position.x);
+		bottomRight.y = std::max(bottomRight.y, vertex.position.y);
+	}
+}
+
+}
+
+sf::FloatRect LevelRenderer::getBounds() const
+{
+	sf::Vector2f topLeft(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+	sf::Vector2f bottomRight(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+
+	for (const auto & layer : tileVertices)
+	{
+		for (const TileVertexArray & vertices : layer)
+		{
+			priv::extendBounds(vertices, topLeft, bottomRight);
+		}
+	}
+
+	priv::extendBounds(objectVertices, topLeft, bottomRight);
+	priv::extendBounds(spawnPointVertices, topLeft, bottomRight);
+
+	if (topLeft.x > bottomRight.x || topLeft.y > bottomRight.y)
+	{
+		return sf::FloatRect();
+	}
+
+	return sf::FloatRect(topLeft, bottomRight - topLeft);
+}
+
+const Level & LevelRenderer::getLevel() const
+{
+	return *level;
+}
+
+bool LevelRenderer::isLevelValid() const
+{
+	return eventListener.isConnected();
+}
+
+std::size_t LevelRenderer::getPendingEventCount() const
+{
+	return eventListener.getQueuedCount();
+}
+
 void LevelRenderer::update()
 {
+	ProfileZone zone("LevelRenderer::update");
+
 	Level::Event event;
 
 	while (eventListener.poll(event))
@@ -72,10 +155,24 @@ void LevelRenderer::update()
 			break;
 		}
 	}
+
+	EventStatistics statistics = eventListener.takeStatistics();
+
+	Profiler::count("Level events pushed", statistics.pushed);
+	Profiler::count("Level events coalesced", statistics.coalesced);
+	Profiler::count("Level events drained", statistics.drained);
+	Profiler::countMax("LevelRenderer queue high-water", statistics.highWaterMark);
+
+	if (statistics.oldestPushTime >= 0 && oldestUndrawnEventTime < 0)
+	{
+		oldestUndrawnEventTime = statistics.oldestPushTime;
+	}
 }
 
 void LevelRenderer::draw(sf::RenderTarget & target, sf::RenderStates states) const
 {
+	ProfileZone zone("LevelRenderer::draw");
+
 	states.texture = tileAppearance->getTexture();
 
 	for (std::size_t layer = 0; layer < tilePositions.size(); ++layer)
@@ -86,6 +183,17 @@ void LevelRenderer::draw(sf::RenderTarget & target, sf::RenderStates states) con
 	target.draw(spawnPointVertices.data(), spawnPointVertices.size(), sf::Triangles, states);
 
 	target.draw(objectVertices.data(), objectVertices.size(), sf::Triangles, states);
+
+	// Measure the time from the oldest level change to the draw call that first shows it.
+	if (oldestUndrawnEventTime >= 0)
+	{
+		if (Profiler::isEnabled())
+		{
+			Profiler::record("Level event latency", oldestUndrawnEventTime, Profiler::getTimestamp());
+		}
+
+		oldestUndrawnEventTime = -1;
+	}
 }
 
 void LevelRenderer::drawTileLayer(TileLayer layer, sf::RenderTarget& target, sf::RenderStates states) const
@@ -4,6 +4,7 @@
 #include <Client/LevelRenderer/ObjectAppearance.hpp>
 #include <Client/LevelRenderer/TileAppearance.hpp>
 #include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Vector2.hpp>
@@ -16,6 +17,7 @@
 #include <vector>
 
 class Dungeon;
+class MemoryUsage;
 
 namespace sf
 {
@@ -41,6 +43,33 @@ public:
 	 */
 	void update();
 
+	/**
+	 * Adds the estimated memory used by the renderer's vertex arrays and lookup tables to the specified object.
+	 */
+	void getMemoryUsage(MemoryUsage & usage) const;
+
+	/**
+	 * Returns the smallest rectangle containing all tiles, objects and the spawn point as they are currently drawn.
+	 * 
+	 * Returns an empty rectangle if nothing is drawn.
+	 */
+	sf::FloatRect getBounds() const;
+
+	/**
+	 * Returns the level this renderer draws.
+	 */
+	const Level & getLevel() const;
+
+	/**
+	 * Returns false if the level has been destroyed since the renderer was created.
+	 */
+	bool isLevelValid() const;
+
+	/**
+	 * Returns the number of level changes that the next call to update() will apply.
+	 */
+	std::size_t getPendingEventCount() const;
+
 private:
 
 	/**
@@ -134,6 +163,11 @@ private:
 	std::vector<sf::Vertex> spawnPointVertices;
 
 	EventListener<Level::Event> eventListener;
+
+	/**
+	 * Profiler timestamp of the oldest level event that has been processed but not drawn yet, or -1 if there is none.
+	 */
+	mutable sf::Int64 oldestUndrawnEventTime;
 };
 
 #endif
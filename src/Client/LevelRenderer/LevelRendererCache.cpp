@@ -0,0 +1,135 @@
+#include <Client/LevelRenderer/LevelRenderer.hpp>
+#include <Client/LevelRenderer/LevelRendererCache.hpp>
+#include <Shared/Utils/MakeUnique.hpp>
+#include <Shared/Utils/MemoryUsage.hpp>
+#include <Shared/Utils/Profiler.hpp>
+#include <algorithm>
+#include <iterator>
+
+LevelRendererCache::LevelRendererCache(const Dungeon & dungeon, const TileAppearanceManager & tileAppearance,
+		const ObjectAppearanceManager & objectAppearance) :
+		dungeon(&dungeon),
+		tileAppearance(&tileAppearance),
+		objectAppearance(&objectAppearance),
+		memoryLimit(64 * 1024 * 1024)
+{
+}
+
+LevelRendererCache::~LevelRendererCache()
+{
+}
+
+LevelRenderer & LevelRendererCache::acquire(const Level & level)
+{
+	ProfileZone zone("LevelRendererCache::acquire");
+
+	removeInvalidRenderers();
+
+	if (!entries.empty() && entries.front().level == &level)
+	{
+		return *entries.front().renderer;
+	}
+
+	// The previously active renderer may have grown while its level was edited.
+	if (!entries.empty())
+	{
+		entries.front().bytes = getRendererBytes(*entries.front().renderer);
+	}
+
+	auto it = std::find_if(entries.begin(), entries.end(), [&](const Entry & entry)
+	{
+		return entry.level == &level;
+	});
+
+	if (it != entries.end())
+	{
+		// Apply all changes made while the renderer was inactive.
+		entries.splice(entries.begin(), entries, it);
+		entries.front().renderer->update();
+	}
+	else
+	{
+		Entry entry;
+		entry.level = &level;
+		entry.renderer = makeUnique<LevelRenderer>(*dungeon, level, *tileAppearance, *objectAppearance);
+		entries.push_front(std::move(entry));
+	}
+
+	entries.front().bytes = getRendererBytes(*entries.front().renderer);
+
+	evict();
+
+	return *entries.front().renderer;
+}
+
+bool LevelRendererCache::contains(const Level & level) const
+{
+	return std::any_of(entries.begin(), entries.end(), [&](const Entry & entry)
+	{
+		return entry.level == &level && entry.renderer->isLevelValid();
+	});
+}
+
+void LevelRendererCache::clear()
+{
+	entries.clear();
+}
+
+void LevelRendererCache::setMemoryLimit(std::size_t bytes)
+{
+	memoryLimit = bytes;
+	evict();
+}
+
+std::size_t LevelRendererCache::getMemoryLimit() const
+{
+	return memoryLimit;
+}
+
+std::size_t LevelRendererCache::getRendererCount() const
+{
+	return entries.size();
+}
+
+void LevelRendererCache::getMemoryUsage(MemoryUsage & usage) const
+{
+	for (const Entry & entry : entries)
+	{
+		entry.renderer->getMemoryUsage(usage);
+	}
+
+	usage.add("cached renderers", entries.size() * (sizeof(Entry) + sizeof(LevelRenderer) + MemoryUsage::NodeOverhead),
+		entries.size());
+}
+
+void LevelRendererCache::removeInvalidRenderers()
+{
+	// A destroyed level's address may be reused by a new level, so the address alone does not identify a level.
+	entries.remove_if([](const Entry & entry)
+	{
+		return !entry.renderer->isLevelValid();
+	});
+}
+
+void LevelRendererCache::evict()
+{
+	std::size_t totalBytes = 0;
+
+	for (const Entry & entry : entries)
+	{
+		totalBytes += entry.bytes;
+	}
+
+	while (entries.size() > 1 && totalBytes > memoryLimit)
+	{
+		totalBytes -= entries.back().bytes;
+		entries.pop_back();
+	}
+}
+
+std::size_t LevelRendererCache::getRendererBytes(const LevelRenderer & renderer)
+{
+	MemoryUsage usage;
+	renderer.getMemoryUsage(usage);
+	return usage.getTotalBytes();
+}
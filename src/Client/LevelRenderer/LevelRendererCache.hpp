@@ -0,0 +1,105 @@
+#ifndef SRC_CLIENT_LEVELRENDERER_LEVELRENDERERCACHE_HPP_
+#define SRC_CLIENT_LEVELRENDERER_LEVELRENDERERCACHE_HPP_
+
+#include <cstddef>
+#include <list>
+#include <memory>
+
+class Dungeon;
+class Level;
+class LevelRenderer;
+class MemoryUsage;
+class ObjectAppearanceManager;
+class TileAppearanceManager;
+
+/**
+ * Keeps the renderers of recently displayed levels alive, so that switching back to a level does not rebuild all of
+ * its vertices.
+ * 
+ * Inactive renderers keep listening to their level's events and apply all changes when they are acquired again.
+ * Renderers are evicted in least recently used order once their combined memory usage exceeds the memory limit. The
+ * most recently acquired renderer is never evicted.
+ */
+class LevelRendererCache
+{
+public:
+
+	/**
+	 * Creates an empty cache for renderers of levels in the specified dungeon.
+	 */
+	LevelRendererCache(const Dungeon & dungeon, const TileAppearanceManager & tileAppearance,
+			const ObjectAppearanceManager & objectAppearance);
+
+	~LevelRendererCache();
+
+	/**
+	 * Returns an up-to-date renderer for the specified level, creating it if it is not cached.
+	 * 
+	 * The renderer remains valid until it is evicted by a later call to acquire() or removed by clear().
+	 */
+	LevelRenderer & acquire(const Level & level);
+
+	/**
+	 * Returns true if a renderer for the specified level is cached.
+	 */
+	bool contains(const Level & level) const;
+
+	/**
+	 * Removes all renderers.
+	 */
+	void clear();
+
+	/**
+	 * Sets the combined memory usage above which inactive renderers are evicted. Defaults to 64 MiB.
+	 */
+	void setMemoryLimit(std::size_t bytes);
+	std::size_t getMemoryLimit() const;
+
+	/**
+	 * Returns the number of cached renderers.
+	 */
+	std::size_t getRendererCount() const;
+
+	/**
+	 * Adds the estimated memory used by all cached renderers to the specified object.
+	 */
+	void getMemoryUsage(MemoryUsage & usage) const;
+
+private:
+
+	struct Entry
+	{
+		const Level * level;
+		std::unique_ptr<LevelRenderer> renderer;
+
+		/**
+		 * Memory usage of the renderer at the time it was last acquired or deactivated.
+		 */
+		std::size_t bytes;
+	};
+
+	/**
+	 * Removes renderers whose level has been destroyed.
+	 */
+	void removeInvalidRenderers();
+
+	/**
+	 * Removes the least recently used renderers until the memory limit is satisfied.
+	 */
+	void evict();
+
+	static std::size_t getRendererBytes(const LevelRenderer & renderer);
+
+	const Dungeon * dungeon;
+	const TileAppearanceManager * tileAppearance;
+	const ObjectAppearanceManager * objectAppearance;
+
+	/**
+	 * Cached renderers, starting with the most recently acquired one.
+	 */
+	std::list<Entry> entries;
+
+	std::size_t memoryLimit;
+};
+
+#endif
@@ -247,7 +247,7 @@ bool ObjectAppearanceManager::loadItems(const pugi::xml_document& doc, const std
 		item.nodeID = myPacker->addOwn(std::move(croppedItemImage));
 
 		// Insert into item map.
-		myItems.insert(std::make_pair(itemID, std::move(item)));
+		myItems.insert(std::make_pair(StringInterner::intern(itemID), std::move(item)));
 	}
 
 	return true;
@@ -305,7 +305,7 @@ std::vector<sf::Vertex> ObjectAppearanceManager::getObjectVertices(const Object&
 	}
 	else if (object.getType() == Object::Type::Item)
 	{
-		auto it = myItems.find(object.getPropertyString(Object::Property::Type));
+		auto it = myItems.find(object.getPropertySymbol(Object::Property::Type));
 
 		if (it == myItems.end())
 		{
@@ -424,7 +424,7 @@ std::vector<sf::Vertex> ObjectAppearanceManager::getObjectVertices(const Object&
 	{
 		Object content(object.getPosition(), Object::Type::Item);
 
-		content.setPropertyString(Object::Property::Type, object.getPropertyName(Object::Property::Contents));
+		content.setPropertySymbol(Object::Property::Type, object.getPropertySymbol(Object::Property::Contents));
 
 		std::vector<sf::Vertex> contentVertices = getObjectVertices(content);
 
@@ -457,7 +457,7 @@ const std::string& ObjectAppearanceManager::getObjectName(const Object& object)
 	}
 	else if (object.getType() == Object::Type::Item)
 	{
-		auto it = myItems.find(object.getPropertyString(Object::Property::Type));
+		auto it = myItems.find(object.getPropertySymbol(Object::Property::Type));
 
 		if (it == myItems.end())
 		{
@@ -623,9 +623,12 @@ std::vector<std::string> ObjectAppearanceManager::getItemNameList() const
 
 	for (auto it = myItems.begin(); it != myItems.end(); ++it)
 	{
-		itemNameList.push_back(it->first);
+		itemNameList.push_back(StringInterner::getString(it->first));
 	}
 
+	// Item map is unordered: sort names to keep the palette order stable.
+	std::sort(itemNameList.begin(), itemNameList.end());
+
 	return itemNameList;
 }
 
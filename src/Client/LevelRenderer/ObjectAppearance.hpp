@@ -12,8 +12,10 @@
 #include <Client/LevelRenderer/AppearanceLoader.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <Shared/Level/Object.hpp>
+#include <Shared/Utils/StringInterner.hpp>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace pugi
@@ -154,7 +156,7 @@ private:
 	ITexturePacker * myPacker;
 
 	std::map<EnemyID, EnemyAppearance> myEnemies;
-	std::map<std::string, ItemAppearance> myItems;
+	std::unordered_map<StringInterner::Symbol, ItemAppearance> myItems;
 
 	std::map<ObjectID, ObjectAppearance> myTraps;
 	std::map<ObjectID, ObjectAppearance> myCrates;
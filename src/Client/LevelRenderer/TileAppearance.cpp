@@ -9,6 +9,7 @@
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
 #include <Shared/Utils/MakeUnique.hpp>
 #include <Shared/Utils/StrNumCon.hpp>
 #include <algorithm>
@@ -169,6 +170,70 @@ std::vector<sf::Vertex> TileAppearanceManager::getSingleTileVertices(
 	};
 }
 
+void TileAppearanceManager::updateTileColors()
+{
+	if (myPacker->getTexture() == nullptr)
+	{
+		return;
+	}
+
+	sf::Image atlas = myPacker->getTexture()->copyToImage();
+
+	for (auto & tile : myTiles)
+	{
+		for (TileVariantAppearance & variant : tile.second.variants)
+		{
+			sf::IntRect rect = myPacker->getImageRect(variant.nodeID);
+
+			// Weight each pixel by its opacity to ignore transparent borders.
+			sf::Uint64 red = 0, green = 0, blue = 0, alpha = 0;
+			std::size_t pixelCount = 0;
+
+			for (int y = rect.top; y < rect.top + rect.height; ++y)
+			{
+				for (int x = rect.left; x < rect.left + rect.width; ++x)
+				{
+					sf::Color pixel = atlas.getPixel(x, y);
+					red += pixel.r * pixel.a;
+					green += pixel.g * pixel.a;
+					blue += pixel.b * pixel.a;
+					alpha += pixel.a;
+					pixelCount++;
+				}
+			}
+
+			if (alpha == 0)
+			{
+				variant.color = sf::Color::Transparent;
+			}
+			else
+			{
+				variant.color = sf::Color(red / alpha, green / alpha, blue / alpha, alpha / pixelCount);
+			}
+		}
+	}
+}
+
+sf::Color TileAppearanceManager::getTileColor(const Tile & tile) const
+{
+	const TileVariantAppearance * variant = getTileVariant(tile);
+
+	if (variant == nullptr)
+	{
+		return sf::Color::Transparent;
+	}
+
+	// Semi-transparent overlays (such as wire tiles) are represented by their base tile.
+	if (variant->baseTile != Tile::Invalid)
+	{
+		Tile baseTile = tile;
+		baseTile.id = variant->baseTile;
+		return getTileColor(baseTile);
+	}
+
+	return variant->color;
+}
+
 std::vector<Tile::ID> TileAppearanceManager::getTileIDList() const
 {
 	std::vector<Tile::ID> tileList;
@@ -205,7 +270,8 @@ TileAppearanceManager::TileVariantAppearance::TileVariantAppearance() :
 		nodeID(ITexturePacker::packFailure),
 		yOffset(0.f),
 		baseTile(Tile::Invalid),
-		opacity(255)
+		opacity(255),
+		color(sf::Color::Transparent)
 {
 }
 
@@ -11,6 +11,7 @@
 #include <Client/Graphics/Packing/ITexturePacker.hpp>
 #include <Client/LevelRenderer/AppearanceLoader.hpp>
 #include <SFML/Config.hpp>
+#include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <Shared/Level/Tile.hpp>
@@ -51,6 +52,18 @@ public:
 	 */
 	std::vector<sf::Vertex> getTileVertices(const Tile & tile, sf::Vector2i position) const;
 	
+	/**
+	 * Computes the average color of each tile's image. Has to be called after the texture packer has been packed.
+	 */
+	void updateTileColors();
+
+	/**
+	 * Returns the average color of the given tile's image, as computed by the last call to updateTileColors().
+	 * 
+	 * Returns a transparent color for tiles without an appearance.
+	 */
+	sf::Color getTileColor(const Tile & tile) const;
+
 	/**
 	 * Returns a list of all valid tile IDs.
 	 */
@@ -78,6 +91,7 @@ private:
 		float yOffset;
 		Tile::ID baseTile;
 		sf::Uint8 opacity;
+		sf::Color color;
 	};
 
 	struct TileAppearance
@@ -1,11 +1,19 @@
 #include <Client/Graphics/BitmapText.hpp>
+#include <Client/Graphics/Packing/SortingTexturePacker.hpp>
+#include <Client/Graphics/Packing/TexturePacker.hpp>
+#include <Client/LevelRenderer/LevelImageRenderer.hpp>
+#include <Client/LevelRenderer/ObjectAppearance.hpp>
+#include <Client/LevelRenderer/TileAppearance.hpp>
 #include <Client/System/GameDirectoryGuesser.hpp>
 #include <Client/System/NEApplication.hpp>
 #include <Client/System/NEInterface.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <Shared/Level/Dungeon.hpp>
 #include <Shared/Utils/FileChooser.hpp>
+#include <Shared/Utils/MakeUnique.hpp>
 #include <Shared/Utils/MessageBox.hpp>
 #include <Shared/Utils/OSDetect.hpp>
+#include <Shared/Utils/StrNumCon.hpp>
 #include <Shared/Utils/Utilities.hpp>
 #include <cstdbool>
 #include <exception>
@@ -103,13 +111,27 @@ int NEApplication::init(const std::vector<std::string>& args)
 		ArgNone,
 		ArgGameDirectory,
 		ArgResourceDirectory,
+		ArgRecordInput,
+		ArgReplayInput,
+		ArgReplayTimings,
+		ArgRender,
+		ArgRenderScale,
+		ArgRenderSize,
 		ArgDungeon
 	};
 
+	bool offscreen = false;
+	bool continuous = false;
+	float renderScale = 1.f;
+	unsigned int renderSize = 0;
+
 	ArgMode argMode = ArgNone;
 
-	for (const std::string & arg : args)
+	// Skip the executable name.
+	for (std::size_t i = 1; i < args.size(); ++i)
 	{
+		const std::string & arg = args[i];
+
 		switch (argMode)
 		{
 		case ArgNone:
@@ -126,6 +148,54 @@ int NEApplication::init(const std::vector<std::string>& args)
 				break;
 			}
 
+			if (arg == "--record")
+			{
+				argMode = ArgRecordInput;
+				break;
+			}
+
+			if (arg == "--replay")
+			{
+				argMode = ArgReplayInput;
+				break;
+			}
+
+			if (arg == "--replay-timings")
+			{
+				argMode = ArgReplayTimings;
+				break;
+			}
+
+			if (arg == "--render")
+			{
+				argMode = ArgRender;
+				break;
+			}
+
+			if (arg == "--render-scale")
+			{
+				argMode = ArgRenderScale;
+				break;
+			}
+
+			if (arg == "--render-size")
+			{
+				argMode = ArgRenderSize;
+				break;
+			}
+
+			if (arg == "--offscreen")
+			{
+				offscreen = true;
+				break;
+			}
+
+			if (arg == "--continuous")
+			{
+				continuous = true;
+				break;
+			}
+
 			if (arg == "--")
 			{
 				argMode = ArgDungeon;
@@ -141,16 +211,7 @@ int NEApplication::init(const std::vector<std::string>& args)
 			// Fall through to dungeon file specification.
 
 		case ArgDungeon:
-			// Only allow specifying one dungeon file.
-			if (dungeonFile.empty())
-			{
-				dungeonFile = arg;
-			}
-			else
-			{
-				printUsage(args[0]);
-				return LoadErrorArgs;
-			}
+			dungeonFiles.push_back(arg);
 			break;
 
 		case ArgGameDirectory:
@@ -163,17 +224,54 @@ int NEApplication::init(const std::vector<std::string>& args)
 			argMode = ArgNone;
 			break;
 
+		case ArgRecordInput:
+			recordFile = arg;
+			argMode = ArgNone;
+			break;
+
+		case ArgReplayInput:
+			replayFile = arg;
+			argMode = ArgNone;
+			break;
+
+		case ArgReplayTimings:
+			replayTimingFile = arg;
+			argMode = ArgNone;
+			break;
+
+		case ArgRender:
+			renderDirectory = arg;
+			argMode = ArgNone;
+			break;
+
+		case ArgRenderScale:
+			renderScale = cStoN<float>(arg);
+			argMode = ArgNone;
+			break;
+
+		case ArgRenderSize:
+			renderSize = cStoN<unsigned int>(arg);
+			argMode = ArgNone;
+			break;
+
 		default:
 			break;
 		}
 	}
 
-	if (argMode != ArgNone)
+	if (argMode != ArgNone && argMode != ArgDungeon)
 	{
 		printUsage(args[0]);
 		return 1;
 	}
 
+	// Only allow specifying one dungeon file, unless rendering images.
+	if (renderDirectory.empty() && dungeonFiles.size() > 1)
+	{
+		printUsage(args[0]);
+		return LoadErrorArgs;
+	}
+
 	if (resourceDirectory.empty() || resourceDirectory.back() != '/')
 	{
 		resourceDirectory.push_back('/');
@@ -184,6 +282,11 @@ int NEApplication::init(const std::vector<std::string>& args)
 		return LoadErrorNecroAssets;
 	}
 
+	if (!renderDirectory.empty())
+	{
+		return renderDungeons(renderScale, renderSize);
+	}
+
 	try
 	{
 		setFont(FontDefault, loadFont(resourceDirectory + "necroedit-font.png"));
@@ -199,19 +302,105 @@ int NEApplication::init(const std::vector<std::string>& args)
 
 	setTextureSmoothingEnabled(false);
 
-	open();
+	// Only redraw when something changes, so an idle editor does not keep a CPU core busy.
+	setEventDrivenEnabled(!continuous);
+
+	std::shared_ptr<gui2::Interface> interface = open();
+
+	if (!recordFile.empty())
+	{
+		recordInput(interface, recordFile);
+	}
+
+	if (!replayFile.empty())
+	{
+		std::shared_ptr<gui2::InputRecording> recording = std::make_shared<gui2::InputRecording>();
+
+		if (!recording->loadFromFile(replayFile))
+		{
+			std::cerr << "Failed to load input recording " << replayFile << std::endl;
+			return LoadErrorReplay;
+		}
+
+		interface->setOffscreenRenderingEnabled(offscreen);
+		replayInput(interface, recording, replayTimingFile);
+	}
 
 	return LoadSuccess;
 }
 
+int NEApplication::renderDungeons(float scale, unsigned int maximumSize)
+{
+	std::string gameDataDirectory = gameDirectory + "/data/";
+	std::string editorConfig = readFile(resourceDirectory + "necroedit.res");
+
+	SortingTexturePacker texturePacker(makeUnique<TexturePacker>(sf::Vector2u(1024, 512)));
+	TileAppearanceManager tileAppearance(&texturePacker);
+	ObjectAppearanceManager objectAppearance(&texturePacker);
+
+	tileAppearance.loadTiles(editorConfig, gameDataDirectory);
+	objectAppearance.loadXMLObjects(readFile(gameDataDirectory + "necrodancer.xml"), gameDataDirectory);
+	objectAppearance.loadTXTObjects(editorConfig, gameDataDirectory);
+
+	texturePacker.pack();
+
+	LevelImageRenderer renderer(tileAppearance, objectAppearance);
+	renderer.setScale(scale);
+	renderer.setMaximumImageSize(sf::Vector2u(maximumSize, maximumSize));
+
+	if (renderDirectory.back() != '/')
+	{
+		renderDirectory.push_back('/');
+	}
+
+	createDirectoryStructure(renderDirectory);
+
+	bool success = true;
+
+	for (const std::string & file : dungeonFiles)
+	{
+		Dungeon dungeon;
+
+		if (!dungeon.loadFromXML(file))
+		{
+			std::cerr << "Failed to load dungeon " << file << std::endl;
+			success = false;
+			continue;
+		}
+
+		std::string prefix = renderDirectory + removeFileExtension(removeFilePath(file)) + "-";
+		std::size_t savedCount = renderer.saveDungeon(dungeon, prefix);
+
+		std::cout << file << ": rendered " << savedCount << " of " << dungeon.getLevelCount() << " levels" << std::endl;
+
+		if (savedCount != dungeon.getLevelCount())
+		{
+			success = false;
+		}
+	}
+
+	return success ? LoadSuccess : LoadErrorRender;
+}
+
 void NEApplication::printUsage(const std::string & exeName)
 {
 	std::cout << "Usage: " << exeName << " [Options] [Dungeon File]" << std::endl;
+	std::cout << "       " << exeName << " [Options] --render [dir] [Dungeon Files...]" << std::endl;
 	std::cout << "Options:" << std::endl;
 	std::cout << "-g / --game-directory [dir]: Specify [dir] as containing the game's executable and resource files"
 		<< std::endl;
 	std::cout << "-r / --resource-directory [dir]: Specify [dir] as containing the editor's resource files"
 		<< std::endl;
+	std::cout << "--record [file]: Record all input of this session to [file]" << std::endl;
+	std::cout << "--replay [file]: Replay recorded input from [file] as fast as possible, print frame timings and exit"
+		<< std::endl;
+	std::cout << "--replay-timings [file]: Write the duration of each replayed frame to [file] (CSV)" << std::endl;
+	std::cout << "--render [dir]: Save an image of each level of all given dungeon files to [dir] and exit"
+		<< std::endl;
+	std::cout << "--render-scale [factor]: Scale rendered level images by [factor] (default 1)" << std::endl;
+	std::cout << "--render-size [pixels]: Shrink rendered level images to fit [pixels] x [pixels]" << std::endl;
+	std::cout << "--offscreen: Render into an off-screen texture and hide the window while replaying" << std::endl;
+	std::cout << "--continuous: Redraw the editor every frame, even if nothing changes" << std::endl;
 	std::cout << "-h / --help: Show this help" << std::endl;
 	std::cout << "--: Treat following arguments as dungeon file to load, rather than as options" << std::endl;
 }
@@ -27,6 +27,8 @@ private:
 		LoadErrorFont,
 		LoadErrorAssetFile,
 		LoadErrorNecroAssets,
+		LoadErrorReplay,
+		LoadErrorRender,
 	};
 	
 	int init(const std::vector<std::string> & args) override;
@@ -35,6 +37,8 @@ private:
 	
 	bool checkGameDirectory() const;
 	bool chooseGameDirectory();
+
+	int renderDungeons(float scale, unsigned int maximumSize);
 	
 	bool onLoadImage(const std::string & imageIdentifier, sf::Image & image) override;
 	
@@ -42,7 +46,13 @@ private:
 	
 	std::string gameDirectory;
 	std::string resourceDirectory;
-	std::string dungeonFile;
+	std::vector<std::string> dungeonFiles;
+
+	std::string recordFile;
+	std::string replayFile;
+	std::string replayTimingFile;
+
+	std::string renderDirectory;
 };
 
 #endif
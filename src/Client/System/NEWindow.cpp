@@ -15,8 +15,11 @@
 #include <Shared/Level/Dungeon.hpp>
 #include <Shared/Level/Level.hpp>
 #include <Shared/Utils/MakeUnique.hpp>
+#include <Shared/Utils/MemoryUsage.hpp>
 #include <Shared/Utils/NamedFactory.hpp>
+#include <Shared/Utils/Profiler.hpp>
 #include <Shared/Utils/StrNumCon.hpp>
+#include <Shared/Utils/StringInterner.hpp>
 #include <Shared/Utils/Utilities.hpp>
 #include <algorithm>
 #include <cstdbool>
@@ -142,6 +145,7 @@ void NEWindow::initResources()
 	objectAppearance->loadTXTObjects(editorConfig, gameDataDirectory);
 
 	texturePacker->pack();
+	tileAppearance->updateTileColors();
 
 	editorData.tileAppearance = tileAppearance.get();
 	editorData.objectAppearance = objectAppearance.get();
@@ -189,11 +193,26 @@ void NEWindow::initPanels()
 	tooltipBackground->setZPosition(9);
 	tooltipBackground->setEnabled(false);
 	add(tooltipBackground);
+
+	profilerOverlay = gui2::ProfilerOverlay::make();
+	profilerOverlay->setZPosition(20);
+	profilerOverlay->setVisible(false);
+	add(profilerOverlay);
+
+	memoryOverlay = gui2::MemoryOverlay::make();
+	memoryOverlay->setZPosition(20);
+	memoryOverlay->setVisible(false);
+	memoryOverlay->setSource([this](MemoryUsage & usage)
+	{
+		collectMemoryUsage(usage);
+	});
+	add(memoryOverlay);
 }
 
 void NEWindow::initLevelPanel()
 {
 	levelPanel->setDungeon(dungeon.get());
+	levelPanel->setTileAppearance(tileAppearance.get());
 	levelPanel->setSongs(generateEnumMap("Music"));
 	levelPanel->setBosses(generateEnumMap("Bosses"));
 }
@@ -423,6 +442,12 @@ void NEWindow::onProcessWindow(const gui2::WidgetEvents& events)
 		}
 	}
 
+	// File dialogs run on their own thread, so poll them until they are closed.
+	if (openDialog.isOpen() || saveDialog.isOpen())
+	{
+		requestUpdate();
+	}
+
 	if (openDialog.isDone())
 	{
 		editor->resetCamera();
@@ -483,7 +508,102 @@ void NEWindow::onProcessWindow(const gui2::WidgetEvents& events)
 		saveDungeon();
 	}
 
+	if (events.pressedInputs.contains(sf::Keyboard::F3))
+	{
+		profilerOverlay->setVisible(!profilerOverlay->isVisible());
+	}
+
+	if (events.pressedInputs.contains(sf::Keyboard::F4))
+	{
+		toggleProfilerTrace();
+	}
+
+	if (events.pressedInputs.contains(sf::Keyboard::F5))
+	{
+		memoryOverlay->setVisible(!memoryOverlay->isVisible());
+
+		if (memoryOverlay->isVisible())
+		{
+			memoryOverlay->refresh();
+		}
+	}
+
 	updateTooltip();
+	updateProfilerOverlay();
+	updateMemoryOverlay();
+}
+
+void NEWindow::updateProfilerOverlay()
+{
+	float overlayMargin = 10.f;
+	profilerOverlay->setPosition(mainPanel->getSideSize(gui2::BorderPanel::Left) + overlayMargin, overlayMargin);
+
+	// Only record profiler zones while their results are being displayed or captured.
+	Profiler::setEnabled(profilerOverlay->isVisible() || Profiler::isTracing());
+}
+
+void NEWindow::updateMemoryOverlay()
+{
+	float overlayMargin = 10.f;
+	memoryOverlay->setPosition(
+		getSize().x / getViewMultiplier() - mainPanel->getSideSize(gui2::BorderPanel::Right)
+			- memoryOverlay->getSize().x - overlayMargin,
+		overlayMargin);
+}
+
+void NEWindow::collectMemoryUsage(MemoryUsage & usage) const
+{
+	if (dungeon)
+	{
+		MemoryUsage dungeonUsage;
+		dungeon->getMemoryUsage(dungeonUsage);
+		usage.add("dungeon", dungeonUsage);
+	}
+
+	if (editor)
+	{
+		MemoryUsage rendererUsage;
+		editor->getLevelRendererMemoryUsage(rendererUsage);
+		usage.add("renderer", rendererUsage);
+	}
+
+	if (texturePacker)
+	{
+		MemoryUsage atlasUsage;
+		texturePacker->getMemoryUsage(atlasUsage);
+		usage.add("texture atlas", atlasUsage);
+	}
+
+	MemoryUsage guiUsage;
+	gui2::Window::getMemoryUsage(guiUsage);
+	usage.add("gui", guiUsage);
+
+	StringInterner::getMemoryUsage(usage);
+}
+
+void NEWindow::toggleProfilerTrace()
+{
+	if (!Profiler::isTracing())
+	{
+		Profiler::startTrace();
+		return;
+	}
+
+	Profiler::stopTrace();
+
+	std::string traceFile = "necroedit-trace.json";
+
+	if (Profiler::saveChromeTrace(traceFile))
+	{
+		errorMessage->setMessage("Saved " + cNtoS(Profiler::getTraceRecordCount()) + " profiler zones to " + traceFile
+			+ ".\nOpen it in chrome://tracing for analysis.");
+	}
+	else
+	{
+		errorMessage->setMessage("Failed to save profiler trace to " + traceFile + ".");
+	}
+
+	errorMessage->show();
 }
 
 NEApplication* NEWindow::getParentApplication() const
@@ -9,7 +9,9 @@
 #include <Client/GUI2/Panels/GridPanel.hpp>
 #include <Client/GUI2/Widgets/Button.hpp>
 #include <Client/GUI2/Widgets/Gradient.hpp>
+#include <Client/GUI2/Widgets/MemoryOverlay.hpp>
 #include <Client/GUI2/Widgets/MessageBox.hpp>
+#include <Client/GUI2/Widgets/ProfilerOverlay.hpp>
 #include <Client/GUI2/Widgets/Text.hpp>
 #include <Shared/Level/Tile.hpp>
 #include <Shared/Utils/FileChooser.hpp>
@@ -69,6 +71,12 @@ private:
 
 	void updateTilePanels();
 	void updateTooltip();
+	void updateProfilerOverlay();
+	void updateMemoryOverlay();
+
+	void collectMemoryUsage(MemoryUsage & usage) const;
+
+	void toggleProfilerTrace();
 
 	void onProcessWindow(const gui2::WidgetEvents & events) override;
 
@@ -109,6 +117,9 @@ private:
 	gui2::Ptr<gui2::Text> tooltip;
 	gui2::Ptr<gui2::Gradient> tooltipBackground;
 
+	gui2::Ptr<gui2::ProfilerOverlay> profilerOverlay;
+	gui2::Ptr<gui2::MemoryOverlay> memoryOverlay;
+
 	std::vector<Tile> floors, walls;
 
 	std::unique_ptr<SortingTexturePacker> texturePacker;
@@ -0,0 +1,303 @@
+#include <Shared/Editor/BatchEdit.hpp>
+#include <Shared/Level/Dungeon.hpp>
+#include <Shared/Level/Level.hpp>
+#include <Shared/Utils/ParallelFor.hpp>
+
+BatchEdit::Result::Result() :
+		tileCount(0),
+		objectCount(0)
+{
+}
+
+BatchEdit::BatchEdit() :
+		tileAction(TileAction::Ignore),
+		tileFilterMask(Brush::TileMask::None),
+		tileReplacementMask(Brush::TileMask::None),
+		objectAction(ObjectAction::Ignore),
+		objectType(Object::Type::None)
+{
+}
+
+void BatchEdit::setTileAction(TileAction action)
+{
+	tileAction = action;
+}
+
+BatchEdit::TileAction BatchEdit::getTileAction() const
+{
+	return tileAction;
+}
+
+void BatchEdit::setTileFilter(Tile pattern, Brush::TileMask mask)
+{
+	tilePattern = pattern;
+	tileFilterMask = mask;
+}
+
+void BatchEdit::setTileReplacement(Tile replacement, Brush::TileMask mask)
+{
+	tileReplacement = replacement;
+	tileReplacementMask = mask;
+}
+
+void BatchEdit::setObjectAction(ObjectAction action)
+{
+	objectAction = action;
+}
+
+BatchEdit::ObjectAction BatchEdit::getObjectAction() const
+{
+	return objectAction;
+}
+
+void BatchEdit::setObjectTypeFilter(Object::Type type)
+{
+	objectType = type;
+}
+
+void BatchEdit::addObjectPropertyFilter(Object::Property property, const std::string& value)
+{
+	PropertyFilter filter;
+
+	filter.property = property;
+
+	// Let an object convert the value, so that it is parsed the same way as property values loaded from a file.
+	Object pattern(Object::Type::None);
+	pattern.setPropertyString(property, value);
+	filter.intValue = pattern.getPropertyInt(property);
+
+	filter.symbol = StringInterner::intern(value);
+
+	objectPropertyFilters.push_back(filter);
+}
+
+void BatchEdit::clearObjectPropertyFilters()
+{
+	objectPropertyFilters.clear();
+}
+
+void BatchEdit::addObjectPropertyReplacement(Object::Property property, const std::string& value)
+{
+	objectPropertyReplacements.emplace_back(property, value);
+}
+
+void BatchEdit::clearObjectPropertyReplacements()
+{
+	objectPropertyReplacements.clear();
+}
+
+BatchEdit::Result BatchEdit::find(const Dungeon& dungeon, std::size_t maxThreads) const
+{
+	Result result;
+	initResult(result, dungeon.getLevelCount());
+
+	// Levels are independent of each other, so each one can be scanned on its own thread.
+	parallelFor(dungeon.getLevelCount(), [&](std::size_t index)
+	{
+		countBatch(result, index, collectMatches(dungeon.getLevel(index)));
+	}, maxThreads);
+
+	sumCounts(result);
+	return result;
+}
+
+BatchEdit::Result BatchEdit::apply(Dungeon& dungeon, std::size_t maxThreads) const
+{
+	Result result;
+	initResult(result, dungeon.getLevelCount());
+
+	// Levels are independent of each other, so each one can be scanned and modified on its own thread.
+	parallelFor(dungeon.getLevelCount(), [&](std::size_t index)
+	{
+		Level & level = dungeon.getLevel(index);
+
+		LevelBatch batch = collectMatches(level);
+		countBatch(result, index, batch);
+		commitBatch(level, batch);
+	}, maxThreads);
+
+	sumCounts(result);
+	return result;
+}
+
+bool BatchEdit::matchesTile(const Tile& tile) const
+{
+	if (!tile.exists())
+	{
+		return false;
+	}
+
+	if ((tileFilterMask & Brush::TileMask::ID) != Brush::TileMask::None && tile.id != tilePattern.id)
+	{
+		return false;
+	}
+
+	if ((tileFilterMask & Brush::TileMask::Zone) != Brush::TileMask::None && tile.getZone() != tilePattern.getZone())
+	{
+		return false;
+	}
+
+	if ((tileFilterMask & Brush::TileMask::Torch) != Brush::TileMask::None && tile.hasTorch != tilePattern.hasTorch)
+	{
+		return false;
+	}
+
+	if ((tileFilterMask & Brush::TileMask::Cracked) != Brush::TileMask::None
+			&& tile.isCracked() != tilePattern.isCracked())
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool BatchEdit::matchesObject(const Object& object) const
+{
+	if (objectType != Object::Type::None && object.getType() != objectType)
+	{
+		return false;
+	}
+
+	for (const PropertyFilter & filter : objectPropertyFilters)
+	{
+		if (!object.hasProperty(filter.property))
+		{
+			return false;
+		}
+
+		switch (Object::getPropertyValueType(object.getType(), filter.property))
+		{
+		case Object::PropertyValueType::Int:
+			if (object.getPropertyInt(filter.property) != filter.intValue)
+			{
+				return false;
+			}
+			break;
+
+		case Object::PropertyValueType::Bool:
+			if ((object.getPropertyInt(filter.property) != 0) != (filter.intValue != 0))
+			{
+				return false;
+			}
+			break;
+
+		case Object::PropertyValueType::String:
+		default:
+			if (object.getPropertySymbol(filter.property) != filter.symbol)
+			{
+				return false;
+			}
+			break;
+		}
+	}
+
+	return true;
+}
+
+void BatchEdit::initResult(Result& result, std::size_t levelCount)
+{
+	result.levelTileCounts.assign(levelCount, 0);
+	result.levelObjectCounts.assign(levelCount, 0);
+}
+
+void BatchEdit::countBatch(Result& result, std::size_t levelIndex, const LevelBatch& batch)
+{
+	result.levelTileCounts[levelIndex] = batch.tilePositions.size();
+	result.levelObjectCounts[levelIndex] = batch.objectIDs.size();
+}
+
+void BatchEdit::sumCounts(Result& result)
+{
+	for (std::size_t i = 0; i < result.levelTileCounts.size(); ++i)
+	{
+		result.tileCount += result.levelTileCounts[i];
+		result.objectCount += result.levelObjectCounts[i];
+	}
+}
+
+BatchEdit::LevelBatch BatchEdit::collectMatches(const Level& level) const
+{
+	LevelBatch batch;
+
+	if (tileAction != TileAction::Ignore)
+	{
+		for (auto it = level.tilesBegin(); it != level.tilesEnd(); ++it)
+		{
+			if (matchesTile(it.getTile()))
+			{
+				batch.tilePositions.push_back(*it);
+			}
+		}
+	}
+
+	if (objectAction != ObjectAction::Ignore)
+	{
+		for (auto it = level.objectsBegin(); it != level.objectsEnd(); ++it)
+		{
+			if (matchesObject(*it))
+			{
+				batch.objectIDs.push_back(it->getID());
+			}
+		}
+	}
+
+	return batch;
+}
+
+void BatchEdit::commitBatch(Level& level, const LevelBatch& batch) const
+{
+	// Matches are collected before any modification, since changing tiles or objects invalidates level iterators.
+	for (sf::Vector2i position : batch.tilePositions)
+	{
+		if (tileAction == TileAction::Erase)
+		{
+			level.setTileAt(position, Tile());
+		}
+		else
+		{
+			level.setTileAt(position, replaceTile(level.getTileAt(position)));
+		}
+	}
+
+	for (Object::ID id : batch.objectIDs)
+	{
+		if (objectAction == ObjectAction::Erase)
+		{
+			level.removeObject(id);
+		}
+		else
+		{
+			Object & object = level.getObject(id);
+
+			for (const auto & replacement : objectPropertyReplacements)
+			{
+				object.setPropertyString(replacement.first, replacement.second);
+			}
+		}
+	}
+}
+
+Tile BatchEdit::replaceTile(Tile tile) const
+{
+	if ((tileReplacementMask & Brush::TileMask::ID) != Brush::TileMask::None)
+	{
+		tile.id = tileReplacement.id;
+	}
+
+	if ((tileReplacementMask & Brush::TileMask::Zone) != Brush::TileMask::None)
+	{
+		tile.setZone(tileReplacement.getZone());
+	}
+
+	if ((tileReplacementMask & Brush::TileMask::Torch) != Brush::TileMask::None)
+	{
+		tile.hasTorch = tileReplacement.hasTorch;
+	}
+
+	if ((tileReplacementMask & Brush::TileMask::Cracked) != Brush::TileMask::None)
+	{
+		tile.setCracked(tileReplacement.isCracked());
+	}
+
+	return tile;
+}
@@ -0,0 +1,176 @@
+#ifndef SRC_SHARED_EDITOR_BATCHEDIT_HPP_
+#define SRC_SHARED_EDITOR_BATCHEDIT_HPP_
+
+#include <Shared/Editor/Brush.hpp>
+#include <Shared/Level/Object.hpp>
+#include <Shared/Level/Tile.hpp>
+#include <Shared/Utils/StringInterner.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Dungeon;
+class Level;
+
+/**
+ * A find/replace operation over the tiles and objects of all levels in a dungeon.
+ *
+ * Tiles are matched by comparing the fields selected by a mask against a pattern tile, objects by their type and any
+ * number of property values. Matching tiles can be modified or erased, matching objects can have properties assigned
+ * or be erased.
+ *
+ * Levels are processed in parallel. Each level is first scanned for matches, which are collected into a batch, and the
+ * batch is then committed to the level. Use find() to count matches without modifying the dungeon.
+ *
+ * Since apply() modifies levels from worker threads, and level events are pushed without synchronization, it must not
+ * be called while an event listener is attached to any level of the dungeon (e.g. one of the editor's renderers).
+ */
+class BatchEdit
+{
+public:
+
+	enum class TileAction
+	{
+		Ignore,
+		Replace,
+		Erase
+	};
+
+	enum class ObjectAction
+	{
+		Ignore,
+		Replace,
+		Erase
+	};
+
+	/**
+	 * Number of matches (or changes) per level and in total.
+	 */
+	struct Result
+	{
+		Result();
+
+		std::size_t tileCount;
+		std::size_t objectCount;
+
+		std::vector<std::size_t> levelTileCounts;
+		std::vector<std::size_t> levelObjectCounts;
+	};
+
+	BatchEdit();
+
+	/**
+	 * Sets what to do with matching tiles. The default is TileAction::Ignore, which skips tile matching entirely.
+	 */
+	void setTileAction(TileAction action);
+	TileAction getTileAction() const;
+
+	/**
+	 * Sets the tile pattern to match. Only the fields selected by the mask are compared, so TileMask::None matches all
+	 * existing tiles. Empty tile positions never match.
+	 */
+	void setTileFilter(Tile pattern, Brush::TileMask mask);
+
+	/**
+	 * Sets the replacement for matching tiles. Only the fields selected by the mask are overwritten. Used with
+	 * TileAction::Replace.
+	 */
+	void setTileReplacement(Tile replacement, Brush::TileMask mask);
+
+	/**
+	 * Sets what to do with matching objects. The default is ObjectAction::Ignore, which skips object matching entirely.
+	 */
+	void setObjectAction(ObjectAction action);
+	ObjectAction getObjectAction() const;
+
+	/**
+	 * Sets the object type to match. Type::None matches objects of any type.
+	 */
+	void setObjectTypeFilter(Object::Type type);
+
+	/**
+	 * Adds a property condition to the object filter. Matching objects must have the property set to the specified
+	 * value. Values are compared according to the property's value type, so "01" matches an integer property set to 1.
+	 */
+	void addObjectPropertyFilter(Object::Property property, const std::string & value);
+
+	/**
+	 * Removes all property conditions from the object filter.
+	 */
+	void clearObjectPropertyFilters();
+
+	/**
+	 * Adds a property assignment to perform on matching objects. Used with ObjectAction::Replace.
+	 */
+	void addObjectPropertyReplacement(Object::Property property, const std::string & value);
+
+	/**
+	 * Removes all property assignments.
+	 */
+	void clearObjectPropertyReplacements();
+
+	/**
+	 * Counts the matching tiles and objects in all levels of the dungeon without modifying it.
+	 *
+	 * Levels are scanned on up to maxThreads threads (0 = hardware concurrency). Pass 1 when calling this from code
+	 * that already runs in parallel, to avoid oversubscribing the CPU.
+	 */
+	Result find(const Dungeon & dungeon, std::size_t maxThreads = 0) const;
+
+	/**
+	 * Performs the edit on all levels of the dungeon and returns the number of affected tiles and objects.
+	 *
+	 * Levels are processed on up to maxThreads threads, as in find(). No event listener may be attached to any of the
+	 * dungeon's levels.
+	 */
+	Result apply(Dungeon & dungeon, std::size_t maxThreads = 0) const;
+
+	/**
+	 * Returns true if the tile matches the tile filter.
+	 */
+	bool matchesTile(const Tile & tile) const;
+
+	/**
+	 * Returns true if the object matches the object filter.
+	 */
+	bool matchesObject(const Object & object) const;
+
+private:
+
+	struct PropertyFilter
+	{
+		Object::Property property;
+		int intValue;
+		StringInterner::Symbol symbol;
+	};
+
+	struct LevelBatch
+	{
+		std::vector<sf::Vector2i> tilePositions;
+		std::vector<Object::ID> objectIDs;
+	};
+
+	static void initResult(Result & result, std::size_t levelCount);
+	static void countBatch(Result & result, std::size_t levelIndex, const LevelBatch & batch);
+	static void sumCounts(Result & result);
+
+	LevelBatch collectMatches(const Level & level) const;
+	void commitBatch(Level & level, const LevelBatch & batch) const;
+
+	Tile replaceTile(Tile tile) const;
+
+	TileAction tileAction;
+	Tile tilePattern;
+	Brush::TileMask tileFilterMask;
+	Tile tileReplacement;
+	Brush::TileMask tileReplacementMask;
+
+	ObjectAction objectAction;
+	Object::Type objectType;
+	std::vector<PropertyFilter> objectPropertyFilters;
+	std::vector<std::pair<Object::Property, std::string> > objectPropertyReplacements;
+};
+
+#endif
@@ -0,0 +1,194 @@
+#include <Shared/Editor/DungeonGenerator.hpp>
+#include <Shared/Level/Dungeon.hpp>
+#include <Shared/Level/Level.hpp>
+#include <Shared/Level/Tile.hpp>
+#include <Shared/Utils/SeededRandom.hpp>
+
+namespace
+{
+
+const Tile::ID floorTiles[] = { 0, 0, 0, 0, 0, 0, 3, 4, 8, 11 };
+const Tile::ID wallTiles[] = { 100, 100, 100, 107, 107, 108, 104, 103 };
+
+const char * const itemNames[] = { "food_1", "food_2", "bomb", "weapon_dagger", "weapon_broadsword",
+	"armor_leather", "armor_chainmail", "ring_might", "torch_1", "shovel_basic" };
+
+// Object type IDs as listed in necroedit.res.
+const int trapTypes[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 14 };
+const int crateTypes[] = { 0, 1, 2 };
+const int chestColors[] = { 1, 2, 3, 4 };
+const sf::Uint32 shrineTypeCount = 16;
+
+// Enemy IDs are defined by the game's data file, which is not available here. This covers the usual ID range.
+const sf::Uint32 enemyTypeCount = 300;
+
+template<typename T, std::size_t N>
+T pick(SeededRandom & random, const T (&values)[N])
+{
+	return values[random.generateBelow(N)];
+}
+
+}
+
+DungeonGenerator::Config::Config() :
+		seed(1),
+		levelCount(1),
+		levelSize(64, 64),
+		tileDensity(0.9f),
+		wallRatio(0.3f),
+		torchFrequency(0.05f),
+		objectDensity(0.1f)
+{
+	objectWeights.fill(1.f);
+}
+
+DungeonGenerator::DungeonGenerator()
+{
+}
+
+void DungeonGenerator::setConfig(const Config & config)
+{
+	this->config = config;
+}
+
+const DungeonGenerator::Config & DungeonGenerator::getConfig() const
+{
+	return config;
+}
+
+void DungeonGenerator::generate(Dungeon & dungeon) const
+{
+	while (dungeon.getLevelCount() > 0)
+	{
+		dungeon.removeLevel(dungeon.getLevelCount() - 1);
+	}
+
+	for (std::size_t i = 0; i < config.levelCount; ++i)
+	{
+		dungeon.insertLevel(i);
+		generateLevel(dungeon.getLevel(i), i);
+	}
+}
+
+void DungeonGenerator::generateLevel(Level & level, std::size_t levelIndex) const
+{
+	SeededRandom random(config.seed + levelIndex);
+
+	float weightSum = 0.f;
+	for (float weight : config.objectWeights)
+	{
+		weightSum += weight;
+	}
+
+	int zone = random.generateBelow(5);
+	sf::Vector2i spawnPoint = config.levelSize / 2;
+
+	for (int y = 0; y < config.levelSize.y; ++y)
+	{
+		for (int x = 0; x < config.levelSize.x; ++x)
+		{
+			sf::Vector2i position(x, y);
+			bool isSpawnPoint = position == spawnPoint;
+
+			if (!isSpawnPoint && !random.generateChance(config.tileDensity))
+			{
+				continue;
+			}
+
+			Tile tile;
+
+			if (!isSpawnPoint && random.generateChance(config.wallRatio))
+			{
+				tile.id = pick(random, wallTiles);
+				tile.hasTorch = random.generateChance(config.torchFrequency);
+			}
+			else
+			{
+				tile.id = pick(random, floorTiles);
+			}
+
+			tile.setZone(zone);
+			tile.setCracked(tile.isWall() && random.generateChance(0.1f));
+			level.setTileAt(position, tile);
+
+			if (tile.isWall() || weightSum <= 0.f)
+			{
+				continue;
+			}
+
+			// Place a whole number of objects matching the average density.
+			float objectCount = config.objectDensity;
+			for (; objectCount >= 1.f || random.generateChance(objectCount); objectCount -= 1.f)
+			{
+				initObject(random, level.getObject(level.addObject(position, pickObjectType(random, weightSum))));
+			}
+		}
+	}
+
+	level.setPlayerSpawnPoint(spawnPoint);
+}
+
+Object::Type DungeonGenerator::pickObjectType(SeededRandom & random, float weightSum) const
+{
+	float value = random.generateNormFloat() * weightSum;
+
+	for (std::size_t i = 0; i < config.objectWeights.size(); ++i)
+	{
+		if (value < config.objectWeights[i])
+		{
+			return Object::Type(i);
+		}
+		value -= config.objectWeights[i];
+	}
+
+	// Rounding errors can leave a small remainder: use the last type with a non-zero weight.
+	for (std::size_t i = config.objectWeights.size(); i > 0; --i)
+	{
+		if (config.objectWeights[i - 1] > 0.f)
+		{
+			return Object::Type(i - 1);
+		}
+	}
+
+	return Object::Type::Trap;
+}
+
+void DungeonGenerator::initObject(SeededRandom & random, Object & object) const
+{
+	for (const auto & property : Object::getDefaultProperties(object.getType()))
+	{
+		object.setPropertyString(property.first, property.second);
+	}
+
+	switch (object.getType())
+	{
+	case Object::Type::Trap:
+		object.setPropertyInt(Object::Property::Type, pick(random, trapTypes));
+		break;
+
+	case Object::Type::Enemy:
+		object.setPropertyInt(Object::Property::Type, random.generateBelow(enemyTypeCount));
+		break;
+
+	case Object::Type::Item:
+		object.setPropertyString(Object::Property::Type, pick(random, itemNames));
+		break;
+
+	case Object::Type::Chest:
+		object.setPropertyInt(Object::Property::Color, pick(random, chestColors));
+		object.setPropertyString(Object::Property::Contents, pick(random, itemNames));
+		break;
+
+	case Object::Type::Crate:
+		object.setPropertyInt(Object::Property::Type, pick(random, crateTypes));
+		object.setPropertyString(Object::Property::Contents, pick(random, itemNames));
+		break;
+
+	case Object::Type::Shrine:
+		object.setPropertyInt(Object::Property::Type, random.generateBelow(shrineTypeCount));
+		break;
+
+	default:
+		break;
+	}
+}
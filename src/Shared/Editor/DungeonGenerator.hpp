@@ -0,0 +1,91 @@
+#ifndef SRC_SHARED_EDITOR_DUNGEONGENERATOR_HPP_
+#define SRC_SHARED_EDITOR_DUNGEONGENERATOR_HPP_
+
+#include <Shared/Level/Object.hpp>
+#include <SFML/Config.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <array>
+#include <cstddef>
+
+class Dungeon;
+class Level;
+class SeededRandom;
+
+/**
+ * Generates dungeons with pseudo-random content for stress testing and benchmarking.
+ *
+ * The output only depends on the configuration, so the same seed always reproduces the same dungeon, also across
+ * platforms (see SeededRandom). Each level is generated from its own seed derived from the dungeon seed and the level
+ * index, so a level's content does not depend on the number of levels before it.
+ */
+class DungeonGenerator
+{
+public:
+
+	struct Config
+	{
+		Config();
+
+		/**
+		 * Seed of the first level. Level i uses seed + i.
+		 */
+		sf::Uint64 seed;
+
+		std::size_t levelCount;
+
+		/**
+		 * Width and height of each level in tiles. Levels span from (0,0) to levelSize - (1,1).
+		 */
+		sf::Vector2i levelSize;
+
+		/**
+		 * Fraction of positions within the level area that have a tile.
+		 */
+		float tileDensity;
+
+		/**
+		 * Fraction of tiles that are walls.
+		 */
+		float wallRatio;
+
+		/**
+		 * Fraction of walls that have a torch.
+		 */
+		float torchFrequency;
+
+		/**
+		 * Average number of objects per floor tile.
+		 */
+		float objectDensity;
+
+		/**
+		 * Relative frequency of each object type. Types with weight 0 are never generated.
+		 */
+		std::array<float, std::size_t(Object::Type::TypeCount)> objectWeights;
+	};
+
+	DungeonGenerator();
+
+	void setConfig(const Config & config);
+	const Config & getConfig() const;
+
+	/**
+	 * Replaces all levels of the dungeon with generated levels.
+	 */
+	void generate(Dungeon & dungeon) const;
+
+	/**
+	 * Adds generated tiles and objects to a single level, using the seed of the level with the specified index. The
+	 * player spawn point is placed on a floor tile in the center of the level.
+	 */
+	void generateLevel(Level & level, std::size_t levelIndex = 0) const;
+
+private:
+
+	Object::Type pickObjectType(SeededRandom & random, float weightSum) const;
+	void initObject(SeededRandom & random, Object & object) const;
+
+	Config config;
+};
+
+#endif
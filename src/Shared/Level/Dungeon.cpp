@@ -4,12 +4,15 @@
 #include <Shared/Level/Level.hpp>
 #include <Shared/Level/Tile.hpp>
 #include <Shared/Utils/MakeUnique.hpp>
+#include <Shared/Utils/MemoryUsage.hpp>
 #include <Shared/Utils/Utilities.hpp>
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <sstream>
 #include <stdexcept>
 
 Dungeon::Dungeon() :
@@ -67,6 +70,18 @@ Level& Dungeon::getLevel(std::size_t index) const
 	return *levels[index];
 }
 
+void Dungeon::getMemoryUsage(MemoryUsage & usage) const
+{
+	usage.add("level list", MemoryUsage::getVectorBytes(levels) + levels.size() * sizeof(Level), levels.size());
+
+	for (std::size_t i = 0; i < levels.size(); ++i)
+	{
+		MemoryUsage levelUsage;
+		levels[i]->getMemoryUsage(levelUsage);
+		usage.add("level " + std::to_string(i + 1), levelUsage);
+	}
+}
+
 void Dungeon::setPlayerCharacter(int character)
 {
 	playerCharacter = character;
@@ -92,9 +107,11 @@ static const std::vector<Object::Type> OBJECT_TYPE_ORDER = { Object::Type::Trap,
 
 bool Dungeon::loadFromXML(const std::string& filename)
 {
-	// Create string to read dungeon file from.
-	std::string xmlData = readFile(filename);
+	return loadFromXMLString(readFile(filename), filename);
+}
 
+bool Dungeon::loadFromXMLString(const std::string& xmlData, const std::string& filename)
+{
 	// Create document to read the dungeon's data into.
 	pugi::xml_document doc;
 
@@ -157,10 +174,23 @@ bool Dungeon::loadFromXML(const std::string& filename)
 		// Load tiles.
 		loadTiles(levelNode, levelID);
 
+		// Find object list nodes in a single pass, keeping the first node of each type.
+		std::array<pugi::xml_node, std::size_t(Object::Type::TypeCount)> objectListNodes;
+
+		for (const auto & childNode : levelNode)
+		{
+			Object::Type type = Object::getTypeByNamePlural(childNode.name());
+
+			if (type != Object::Type::None && objectListNodes[std::size_t(type)].empty())
+			{
+				objectListNodes[std::size_t(type)] = childNode;
+			}
+		}
+
 		// Load objects.
 		for (Object::Type type : OBJECT_TYPE_ORDER)
 		{
-			loadObjects(levelNode, levelID, type);
+			loadObjects(objectListNodes[std::size_t(type)], levelID, type);
 		}
 	}
 
@@ -190,17 +220,15 @@ void Dungeon::loadTiles(const pugi::xml_node& levelNode, std::size_t levelNumber
 	}
 }
 
-void Dungeon::loadObjects(const pugi::xml_node& levelNode, std::size_t levelNumber, Object::Type objectType)
+void Dungeon::loadObjects(const pugi::xml_node& objectListNode, std::size_t levelNumber, Object::Type objectType)
 {
 	Level & level = getLevel(levelNumber);
 
-	for (const auto & objectNode : levelNode.child(Object::getTypeNamePlural(objectType)))
+	for (const auto & objectNode : objectListNode)
 	{
 		sf::Vector2i position(objectNode.attribute("x").as_int(0), objectNode.attribute("y").as_int(0));
 
-		Object & object = level.getObject(level.addObject(objectType));
-
-		object.setPosition(position);
+		Object & object = level.getObject(level.addObject(position, objectType));
 
 		for (auto attrib = objectNode.attributes_begin(); attrib != objectNode.attributes_end(); ++attrib)
 		{
@@ -215,7 +243,7 @@ void Dungeon::loadObjects(const pugi::xml_node& levelNode, std::size_t levelNumb
 
 			const char * propertyValue = attrib->value();
 
-			// Assign property as string. Conversion into number is done later if necessary.
+			// Assign property as string. It is converted to the property's value type on assignment.
 			object.setPropertyString(propertyKey, propertyValue);
 		}
 	}
@@ -223,8 +251,26 @@ void Dungeon::loadObjects(const pugi::xml_node& levelNode, std::size_t levelNumb
 
 bool Dungeon::saveToXML(const std::string& filename) const
 {
-	// Create document to generate the dungeon's data in.
 	pugi::xml_document doc;
+	writeXML(doc, filename);
+
+	// Save document to file.
+	return doc.save_file(filename.c_str());
+}
+
+std::string Dungeon::saveToXMLString(const std::string& filename) const
+{
+	pugi::xml_document doc;
+	writeXML(doc, filename);
+
+	// Serialize document with the same formatting as saveToXML().
+	std::ostringstream stream;
+	doc.save(stream);
+	return stream.str();
+}
+
+void Dungeon::writeXML(pugi::xml_document& doc, const std::string& filename) const
+{
 
 	// Create dungeon node.
 	pugi::xml_node dungeonNode = doc.root().append_child("dungeon");
@@ -252,9 +298,6 @@ bool Dungeon::saveToXML(const std::string& filename) const
 		saveTiles(levelNode, levelID);
 		saveObjects(levelNode, levelID);
 	}
-
-	// Save document to file.
-	return doc.save_file(filename.c_str());
 }
 
 void Dungeon::saveTiles(pugi::xml_node& levelNode, std::size_t levelNumber) const
@@ -272,7 +315,7 @@ void Dungeon::saveTiles(pugi::xml_node& levelNode, std::size_t levelNumber) cons
 		pugi::xml_node tileNode = tilesNode.append_child("tile");
 
 		// Get tile at current iterator position.
-		const Tile & tile = level.getTileAt(*it);
+		const Tile & tile = it.getTile();
 
 		// Assign attributes.
 		tileNode.append_attribute("x").set_value(it->x - playerSpawn.x);
@@ -318,10 +361,15 @@ void Dungeon::saveObjects(pugi::xml_node& levelNode, std::size_t levelNumber) co
 		objectNode.append_attribute("y").set_value(it->getPosition().y - playerSpawn.y);
 
 		// Assign properties.
-		for (auto itProp = it->getAllProperties().begin(); itProp != it->getAllProperties().end(); ++itProp)
+		for (std::size_t i = 0; i < std::size_t(Object::Property::Count); ++i)
 		{
-			const char * propertyName = Object::getPropertyName(itProp->first);
-			objectNode.append_attribute(propertyName).set_value(itProp->second.c_str());
+			Object::Property property = Object::Property(i);
+
+			if (it->hasProperty(property))
+			{
+				const char * propertyName = Object::getPropertyName(property);
+				objectNode.append_attribute(propertyName).set_value(it->getPropertyString(property).c_str());
+			}
 		}
 	}
 }
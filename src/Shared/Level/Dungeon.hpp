@@ -9,10 +9,12 @@
 
 namespace pugi
 {
+class xml_document;
 class xml_node;
 }
 
 class Level;
+class MemoryUsage;
 
 /**
  * A dungeon is an ordered collection of levels and boss levels.
@@ -61,6 +63,11 @@ public:
 	 */
 	Level & getLevel(std::size_t index) const;
 
+	/**
+	 * Adds the estimated memory used by all levels to the memory usage object, grouped as "level 1", "level 2"...
+	 */
+	void getMemoryUsage(MemoryUsage & usage) const;
+
 	/**
 	 * Sets which player character is assigned to this dungeon.
 	 */
@@ -89,6 +96,14 @@ public:
 	 */
 	bool loadFromXML(const std::string & filename);
 
+	/**
+	 * Loads the dungeon from XML data in memory. The file name is only used to derive the dungeon's name if the data
+	 * does not specify one.
+	 * 
+	 * Returns false and leaves the dungeon unchanged if the data is invalid.
+	 */
+	bool loadFromXMLString(const std::string & xmlData, const std::string & filename);
+
 	/**
 	 * Writes the XML file with the specified file name and saves the dungeon to it.
 	 * 
@@ -96,17 +111,27 @@ public:
 	 */
 	bool saveToXML(const std::string & filename) const;
 
+	/**
+	 * Returns the XML data that saveToXML() would write to the file with the specified name.
+	 */
+	std::string saveToXMLString(const std::string & filename) const;
+
 private:
 
+	/**
+	 * Generates the dungeon's XML representation in the specified document.
+	 */
+	void writeXML(pugi::xml_document & doc, const std::string & filename) const;
+
 	/**
 	 * Loads all tiles from the specified XML <level> node.
 	 */
 	void loadTiles(const pugi::xml_node & levelNode, std::size_t levelNumber);
 
 	/**
-	 * Loads a certain type of object from the specified XML <level> node.
+	 * Loads a certain type of object from the specified XML object list node (such as <traps>).
 	 */
-	void loadObjects(const pugi::xml_node & levelNode, std::size_t levelNumber, Object::Type objectType);
+	void loadObjects(const pugi::xml_node & objectListNode, std::size_t levelNumber, Object::Type objectType);
 
 	/**
 	 * Saves all tiles to the specified XML <level> node.
@@ -1,6 +1,7 @@
 #include <Shared/Editor/Brush.hpp>
 #include <Shared/Level/Level.hpp>
 #include <Shared/Utils/MakeUnique.hpp>
+#include <Shared/Utils/MemoryUsage.hpp>
 #include <Shared/Utils/MiscMath.hpp>
 #include <algorithm>
 #include <stdexcept>
@@ -62,6 +63,7 @@ void Level::setTileAt(sf::Vector2i position, Tile tile)
 		{
 			event.type = Event::TileRemoved;
 			section.tileCount--;
+			setTileOccupied(section, positionToTileIndex(position), false);
 		}
 	}
 	else
@@ -74,6 +76,7 @@ void Level::setTileAt(sf::Vector2i position, Tile tile)
 
 		event.type = Event::TileAdded;
 		section.tileCount++;
+		setTileOccupied(section, positionToTileIndex(position), true);
 	}
 
 	targetTile = tile;
@@ -104,7 +107,12 @@ bool Level::hasTileAt(sf::Vector2i position) const
 
 Object::ID Level::addObject(Object::Type type)
 {
-	std::unique_ptr<Object> object = makeUnique<Object>(type);
+	return addObject(sf::Vector2i(), type);
+}
+
+Object::ID Level::addObject(sf::Vector2i position, Object::Type type)
+{
+	std::unique_ptr<Object> object = makeUnique<Object>(position, type);
 
 	object->setObserver(&objectObserver);
 
@@ -153,7 +161,7 @@ void Level::removeObject(Object::ID id)
 	{
 		objects[id] = nullptr;
 
-		while (objects.back() == nullptr)
+		while (!objects.empty() && objects.back() == nullptr)
 		{
 			objects.pop_back();
 		}
@@ -392,41 +400,52 @@ EventListener<Level::Event> Level::acquireEventListener() const
 	return eventManager.acquireListener();
 }
 
-Level::TilePositionIterator Level::tilesBegin() const
+void Level::getMemoryUsage(MemoryUsage & usage) const
 {
-	// If the level is completely empty, return end iterator.
-	if (sections.empty())
+	std::size_t tileCount = 0;
+	std::size_t sectionObjectBytes = 0;
+	std::size_t sectionObjectCount = 0;
+
+	for (const auto & section : sections)
 	{
-		return tilesEnd();
+		tileCount += section.second.tileCount;
+		sectionObjectBytes += MemoryUsage::getVectorBytes(section.second.objects);
+		sectionObjectCount += section.second.objects.size();
 	}
 
-	// Get map iterator to first section.
-	auto it = sections.begin();
+	usage.add("tile sections", MemoryUsage::getMapBytes(sections), sections.size());
+	usage.add("tiles", 0, tileCount);
+	usage.add("section object lists", sectionObjectBytes, sectionObjectCount);
 
-	// Calculate section's top left tile coordinate.
-	sf::Vector2i firstSectionTopLeft = sectionToPosition(it->first);
+	std::size_t objectCount = 0;
 
-	// Get reference to section.
-	const Section & firstSection = it->second;
+	for (const auto & object : objects)
+	{
+		if (object != nullptr)
+		{
+			objectCount++;
+		}
+	}
+
+	usage.add("objects", MemoryUsage::getVectorBytes(objects) + objectCount * sizeof(Object), objectCount);
+}
 
+Level::TilePositionIterator Level::tilesBegin() const
+{
 	// Create iterator to be returned.
-	TilePositionIterator tilePosIterator(this, firstSectionTopLeft);
+	TilePositionIterator tilePosIterator = tilesEnd();
 
-	// Check if first section's first tile does not exist.
-	if (!firstSection.tiles[0].exists())
-	{
-		// If no tile exists, advance iterator to find first valid tile in section.
-		advanceTileIterator(tilePosIterator);
-	}
+	// Find the first existing tile, starting at the first section's top left corner.
+	seekTileIterator(tilePosIterator, sections.begin(), 0);
 
-	// Return the newly created iterator.
+	// Return the iterator.
 	return tilePosIterator;
 }
 
 Level::TilePositionIterator Level::tilesEnd() const
 {
 	// Return null iterator.
-	return TilePositionIterator(nullptr, sf::Vector2i());
+	return TilePositionIterator(nullptr, sections.end(), 0, sf::Vector2i());
 }
 
 Level::ObjectIterator Level::objectsBegin() const
@@ -516,56 +535,35 @@ void Level::removeSectionIfEmpty(sf::Vector2i position)
 
 void Level::advanceTileIterator(TilePositionIterator& iterator) const
 {
-	// Get current section of tile.
-	sf::Vector2i sectionPos = positionToSection(iterator.position);
-
-	// Get map iterator to current section.
-	auto it = sections.find(sectionPos);
-
-	// Calculate section's top left tile coordinate.
-	sf::Vector2i sectionTopLeft = sectionToPosition(it->first);
-
-	// Get reference to section.
-	const Section & section = it->second;
+	// Continue searching right after the current tile, within the iterator's current section.
+	seekTileIterator(iterator, iterator.section, iterator.tileIndex + 1);
+}
 
-	// Find next valid tile in section.
-	for (std::size_t i = positionToTileIndex(iterator.position) + 1; i < SECTION_SIZE * SECTION_SIZE; ++i)
+void Level::seekTileIterator(TilePositionIterator& iterator, SectionMap::const_iterator section,
+		std::size_t firstIndex) const
+{
+	while (section != sections.end())
 	{
-		// Check if tile exists.
-		if (section.tiles[i].exists())
+		// Find next existing tile in section.
+		std::size_t index = findNextTileIndex(section->second, firstIndex);
+
+		if (index < SECTION_TILE_COUNT)
 		{
 			// Assign found tile.
-			iterator.position = sectionTopLeft + tileIndexToSubPosition(i);
+			iterator.level = this;
+			iterator.section = section;
+			iterator.tileIndex = index;
+			iterator.position = sectionToPosition(section->first) + tileIndexToSubPosition(index);
 			return;
 		}
-	}
-
-	// If no more tiles exist in the current section, check next section.
-	it++;
 
-	// Check if the iterator's current section was the last one.
-	if (it == sections.end())
-	{
-		// Set to end iterator.
-		iterator = tilesEnd();
-		return;
+		// No more tiles in this section, continue at the top left corner of the next one.
+		++section;
+		firstIndex = 0;
 	}
 
-	// Recalculate section's top left tile coordinate.
-	sectionTopLeft = sectionToPosition(it->first);
-
-	// Get updated reference to section.
-	const Section & newSection = it->second;
-
-	// Assign iterator to top-left corner of section.
-	iterator.position = sectionTopLeft;
-
-	// Check if first section's first tile exists.
-	if (!newSection.tiles[0].exists())
-	{
-		// If no tile exists, recursively advance iterator to find first valid tile in section.
-		advanceTileIterator(iterator);
-	}
+	// Out of sections: set to end iterator.
+	iterator = tilesEnd();
 }
 
 void Level::advanceObjectIterator(ObjectIterator& iterator) const
@@ -610,3 +608,45 @@ sf::Vector2i Level::tileIndexToSubPosition(std::size_t index)
 {
 	return sf::Vector2i(index % SECTION_SIZE, index / SECTION_SIZE);
 }
+
+void Level::setTileOccupied(Section& section, std::size_t index, bool occupied)
+{
+	sf::Uint64 bit = sf::Uint64(1) << (index % OCCUPANCY_WORD_BITS);
+
+	if (occupied)
+	{
+		section.occupancy[index / OCCUPANCY_WORD_BITS] |= bit;
+	}
+	else
+	{
+		section.occupancy[index / OCCUPANCY_WORD_BITS] &= ~bit;
+	}
+}
+
+std::size_t Level::findNextTileIndex(const Section& section, std::size_t firstIndex)
+{
+	if (firstIndex >= SECTION_TILE_COUNT)
+	{
+		return SECTION_TILE_COUNT;
+	}
+
+	std::size_t wordIndex = firstIndex / OCCUPANCY_WORD_BITS;
+
+	// Mask out all bits below the start index in the first word.
+	sf::Uint64 word = section.occupancy[wordIndex] & (~sf::Uint64(0) << (firstIndex % OCCUPANCY_WORD_BITS));
+
+	while (true)
+	{
+		if (word != 0)
+		{
+			return wordIndex * OCCUPANCY_WORD_BITS + countTrailingZeros(word);
+		}
+
+		if (++wordIndex == OCCUPANCY_WORD_COUNT)
+		{
+			return SECTION_TILE_COUNT;
+		}
+
+		word = section.occupancy[wordIndex];
+	}
+}
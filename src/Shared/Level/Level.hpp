@@ -1,6 +1,7 @@
 #ifndef SRC_SHARED_LEVEL_LEVEL_HPP_
 #define SRC_SHARED_LEVEL_LEVEL_HPP_
 
+#include <SFML/Config.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <Shared/Level/Object.hpp>
 #include <Shared/Level/ObjectObserver.hpp>
@@ -15,9 +16,33 @@
 #include <vector>
 
 class Brush;
+class MemoryUsage;
 
 class Level
 {
+	static constexpr unsigned int SECTION_SIZE = 16;
+	static constexpr unsigned int SECTION_TILE_COUNT = SECTION_SIZE * SECTION_SIZE;
+	static constexpr unsigned int OCCUPANCY_WORD_BITS = 64;
+	static constexpr unsigned int OCCUPANCY_WORD_COUNT = SECTION_TILE_COUNT / OCCUPANCY_WORD_BITS;
+
+	struct Section
+	{
+		Section() :
+				occupancy(),
+				tileCount(0)
+		{
+		}
+
+		std::array<Tile, SECTION_TILE_COUNT> tiles;
+		std::vector<Object::ID> objects;
+
+		// One bit per tile index, set if the tile at that index exists.
+		std::array<sf::Uint64, OCCUPANCY_WORD_COUNT> occupancy;
+		std::size_t tileCount;
+	};
+
+	typedef std::map<sf::Vector2i, Section> SectionMap;
+
 public:
 
 	class TilePositionIterator
@@ -34,6 +59,14 @@ public:
 			return &position;
 		}
 
+		/**
+		 * Returns the tile at the iterator's position without looking up its section again.
+		 */
+		const Tile & getTile() const
+		{
+			return section->second.tiles[tileIndex];
+		}
+
 		TilePositionIterator & operator++()
 		{
 			if (level)
@@ -64,13 +97,18 @@ public:
 
 	private:
 
-		TilePositionIterator(const Level * level, sf::Vector2i position) :
+		TilePositionIterator(const Level * level, SectionMap::const_iterator section, std::size_t tileIndex,
+				sf::Vector2i position) :
 				level(level),
+				section(section),
+				tileIndex(tileIndex),
 				position(position)
 		{
 		}
 
 		const Level * level;
+		SectionMap::const_iterator section;
+		std::size_t tileIndex;
 		sf::Vector2i position;
 
 		friend class Level;
@@ -153,6 +191,14 @@ public:
 		{
 		}
 
+		/**
+		 * Identical events are coalesced while queued, as listeners only read the level's current state.
+		 */
+		bool operator==(const Event & other) const
+		{
+			return type == other.type && tilePosition == other.tilePosition && objectID == other.objectID;
+		}
+
 		Type type;
 
 		sf::Vector2i tilePosition;
@@ -187,6 +233,11 @@ public:
 	 */
 	Object::ID addObject(Object::Type type = Object::Type::None);
 
+	/**
+	 * Creates an object with the specified position and type and returns its ID.
+	 */
+	Object::ID addObject(sf::Vector2i position, Object::Type type = Object::Type::None);
+
 	/**
 	 * Removes the specified object if it exists.
 	 */
@@ -262,8 +313,15 @@ public:
 	 */
 	EventListener<Event> acquireEventListener() const;
 
+	/**
+	 * Adds the estimated memory used by this level's tiles and objects to the memory usage object.
+	 */
+	void getMemoryUsage(MemoryUsage & usage) const;
+
 	/**
 	 * Returns an iterator for the first tile in the level, iterating over all tiles in an unspecified order.
+	 * 
+	 * Adding or removing tiles invalidates all tile iterators.
 	 */
 	TilePositionIterator tilesBegin() const;
 
@@ -284,22 +342,6 @@ public:
 
 private:
 
-	static constexpr unsigned int SECTION_SIZE = 16;
-
-	struct Section
-	{
-		Section() :
-				tileCount(0)
-		{
-		}
-
-		std::array<Tile, SECTION_SIZE * SECTION_SIZE> tiles;
-		std::vector<Object::ID> objects;
-		std::size_t tileCount;
-	};
-
-	typedef std::map<sf::Vector2i, Section> SectionMap;
-
 	void removeSectionIfEmpty(sf::Vector2i position);
 
 	void onObjectMoved(Object::ID id, sf::Vector2i oldPosition);
@@ -309,6 +351,8 @@ private:
 	void removeObjectFromSection(Object::ID id, sf::Vector2i position);
 
 	void advanceTileIterator(TilePositionIterator & iterator) const;
+	void seekTileIterator(TilePositionIterator & iterator, SectionMap::const_iterator section,
+			std::size_t firstIndex) const;
 	void advanceObjectIterator(ObjectIterator & iterator) const;
 
 	static sf::Vector2i sectionToPosition(sf::Vector2i sectionPosition);
@@ -317,6 +361,9 @@ private:
 	static std::size_t positionToTileIndex(sf::Vector2i position);
 	static sf::Vector2i tileIndexToSubPosition(std::size_t index);
 
+	static void setTileOccupied(Section & section, std::size_t index, bool occupied);
+	static std::size_t findNextTileIndex(const Section & section, std::size_t firstIndex);
+
 	SectionMap sections;
 	std::vector<std::unique_ptr<Object> > objects;
 
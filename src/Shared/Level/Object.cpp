@@ -1,13 +1,49 @@
 #include <Shared/Level/Object.hpp>
 #include <Shared/Level/ObjectObserver.hpp>
+#include <Shared/Utils/NameLookup.hpp>
 #include <Shared/Utils/StrNumCon.hpp>
+#include <Shared/Utils/StringInterner.hpp>
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+bool parseBool(const std::string & str)
+{
+	if (!str.empty() && std::strchr("tTyY", str[0]) != nullptr)
+	{
+		return true;
+	}
+
+	return cStoI(str) != 0;
+}
+
+template<typename Enum>
+NameLookup<Enum> makeNameLookup(std::size_t count, const char * (*getName)(Enum), Enum invalidValue)
+{
+	std::vector<std::pair<std::string, Enum> > entries;
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		entries.emplace_back(getName(Enum(i)), Enum(i));
+	}
+
+	return NameLookup<Enum>(entries, invalidValue);
+}
+
+}
 
 Object::Object(Type type) :
 		position(),
 		type(type),
+		propertySlots(),
+		propertyMask(0),
+		textMask(0),
 		observer(nullptr),
 		id(0)
 {
@@ -16,6 +52,9 @@ Object::Object(Type type) :
 Object::Object(sf::Vector2i position, Type type) :
 		position(position),
 		type(type),
+		propertySlots(),
+		propertyMask(0),
+		textMask(0),
 		observer(nullptr),
 		id(0)
 {
@@ -24,7 +63,9 @@ Object::Object(sf::Vector2i position, Type type) :
 Object::Object(const Object& object) :
 		position(object.position),
 		type(object.type),
-		properties(object.properties),
+		propertySlots(object.propertySlots),
+		propertyMask(object.propertyMask),
+		textMask(object.textMask),
 		observer(nullptr),
 		id(0)
 {
@@ -37,7 +78,9 @@ Object::~Object()
 void Object::assign(const Object& object)
 {
 	this->type = object.type;
-	this->properties = object.properties;
+	this->propertySlots = object.propertySlots;
+	this->propertyMask = object.propertyMask;
+	this->textMask = object.textMask;
 
 	// A move implies an update, so perform the move as the last operation to only cause one update.
 	setPosition(object.position);
@@ -68,6 +111,24 @@ void Object::setType(Type type)
 {
 	if (this->type != type)
 	{
+		// Re-encode properties whose slot type depends on the object type (e.g. the item name in "type").
+		for (std::size_t i = 0; i < std::size_t(Property::Count); ++i)
+		{
+			Property prop = Property(i);
+			PropertyValueType oldValueType = getPropertyValueType(this->type, prop);
+			PropertyValueType newValueType = getPropertyValueType(type, prop);
+
+			if (hasProperty(prop) && oldValueType != newValueType)
+			{
+				bool isText;
+				PropertyMask bit = PropertyMask(1) << i;
+
+				propertySlots[i] = encodePropertyText(newValueType,
+						decodePropertyValue(getSlotValueType(prop), propertySlots[i]), isText);
+				textMask = isText ? (textMask | bit) : (textMask & ~bit);
+			}
+		}
+
 		this->type = type;
 
 		if (observer)
@@ -84,17 +145,36 @@ Object::Type Object::getType() const
 
 void Object::setPropertyInt(Property prop, int value)
 {
-	properties[prop] = cNtoS(value);
-
-	if (observer)
+	switch (getPropertyValueType(type, prop))
 	{
-		observer->notifyUpdate(id);
+	case PropertyValueType::Int:
+		setPropertySlot(prop, value);
+		break;
+	case PropertyValueType::Bool:
+		setPropertySlot(prop, value != 0);
+		break;
+	case PropertyValueType::String:
+	default:
+		setPropertySlot(prop, StringInterner::intern(cNtoS(value)));
+		break;
 	}
 }
 
 void Object::setPropertyString(Property prop, std::string value)
 {
-	properties[prop] = value;
+	bool isText;
+	sf::Int32 slot = encodePropertyText(getPropertyValueType(type, prop), value, isText);
+	setPropertySlot(prop, slot, isText);
+}
+
+void Object::unsetProperty(Property prop)
+{
+	if (prop < Property::Count)
+	{
+		propertyMask &= ~PropertyMask(PropertyMask(1) << std::size_t(prop));
+		textMask &= ~PropertyMask(PropertyMask(1) << std::size_t(prop));
+		propertySlots[std::size_t(prop)] = 0;
+	}
 
 	if (observer)
 	{
@@ -102,36 +182,75 @@ void Object::setPropertyString(Property prop, std::string value)
 	}
 }
 
-void Object::unsetProperty(Property prop)
+void Object::setPropertySymbol(Property prop, StringInterner::Symbol symbol)
 {
-	properties.erase(prop);
-
-	if (observer)
+	if (getPropertyValueType(type, prop) == PropertyValueType::String)
 	{
-		observer->notifyUpdate(id);
+		setPropertySlot(prop, symbol);
+	}
+	else
+	{
+		setPropertyString(prop, StringInterner::getString(symbol));
 	}
 }
 
 bool Object::hasProperty(Property prop) const
 {
-	return properties.find(prop) != properties.end();
+	return prop < Property::Count && (propertyMask & (PropertyMask(1) << std::size_t(prop))) != 0;
 }
 
 int Object::getPropertyInt(Property prop) const
 {
-	auto it = properties.find(prop);
-	return it != properties.end() ? cStoI(it->second) : 0;
+	if (!hasProperty(prop))
+	{
+		return 0;
+	}
+
+	sf::Int32 value = propertySlots[std::size_t(prop)];
+	PropertyValueType valueType = getPropertyValueType(type, prop);
+
+	switch (valueType)
+	{
+	case PropertyValueType::Int:
+	case PropertyValueType::Bool:
+		// Text slots are parsed like values loaded from a file, so "True" still counts as 1.
+		if (getSlotValueType(prop) == PropertyValueType::String)
+		{
+			return encodePropertyValue(valueType, StringInterner::getString(value));
+		}
+		return value;
+	case PropertyValueType::String:
+	default:
+		return cStoI(StringInterner::getString(value));
+	}
 }
 
-std::string Object::getPropertyString(Property prop) const
+StringInterner::Symbol Object::getPropertySymbol(Property prop) const
 {
-	auto it = properties.find(prop);
-	return it != properties.end() ? it->second : "";
+	if (!hasProperty(prop))
+	{
+		return StringInterner::EmptySymbol;
+	}
+
+	if (getSlotValueType(prop) == PropertyValueType::String)
+	{
+		return propertySlots[std::size_t(prop)];
+	}
+	else
+	{
+		// Looking up numeric values keeps matching code from filling the pool with every number it encounters.
+		return StringInterner::find(getPropertyString(prop));
+	}
 }
 
-const std::map<Object::Property, std::string>& Object::getAllProperties() const
+std::string Object::getPropertyString(Property prop) const
 {
-	return properties;
+	if (!hasProperty(prop))
+	{
+		return "";
+	}
+
+	return decodePropertyValue(getSlotValueType(prop), propertySlots[std::size_t(prop)]);
 }
 
 Object::ID Object::getID() const
@@ -181,6 +300,21 @@ const char* Object::getTypeNamePlural(Type type)
 	}
 }
 
+Object::Type Object::getTypeByName(const char * typeName)
+{
+	static const NameLookup<Type> lookup = makeNameLookup(std::size_t(Type::TypeCount), getTypeName, Type::None);
+
+	return lookup.find(typeName);
+}
+
+Object::Type Object::getTypeByNamePlural(const char * typeName)
+{
+	static const NameLookup<Type> lookup = makeNameLookup(std::size_t(Type::TypeCount), getTypeNamePlural,
+			Type::None);
+
+	return lookup.find(typeName);
+}
+
 const char * Object::getPropertyName(Property prop)
 {
 	switch (prop)
@@ -214,16 +348,15 @@ const char * Object::getPropertyName(Property prop)
 
 Object::Property Object::getPropertyByName(const char * propName)
 {
-	for (std::size_t i = 0; i < std::size_t(Property::Count); ++i)
-	{
-		Property property = Property(i);
+	return getPropertyByName(propName, std::strlen(propName));
+}
 
-		if (std::strcmp(getPropertyName(property), propName) == 0)
-		{
-			return property;
-		}
-	}
-	return Property::Invalid;
+Object::Property Object::getPropertyByName(const char * propName, std::size_t length)
+{
+	static const NameLookup<Property> lookup = makeNameLookup(std::size_t(Property::Count), getPropertyName,
+			Property::Invalid);
+
+	return lookup.find(propName, length);
 }
 
 Object::PropertyValueType Object::getPropertyValueType(Type type, Property property)
@@ -335,3 +468,67 @@ ObjectObserver * Object::getObserver() const
 {
 	return observer;
 }
+
+void Object::setPropertySlot(Property prop, sf::Int32 value, bool isText)
+{
+	if (prop >= Property::Count)
+	{
+		return;
+	}
+
+	PropertyMask bit = PropertyMask(1) << std::size_t(prop);
+
+	propertySlots[std::size_t(prop)] = value;
+	propertyMask |= bit;
+	textMask = isText ? (textMask | bit) : (textMask & ~bit);
+
+	if (observer)
+	{
+		observer->notifyUpdate(id);
+	}
+}
+
+sf::Int32 Object::encodePropertyValue(PropertyValueType valueType, const std::string & value)
+{
+	switch (valueType)
+	{
+	case PropertyValueType::Int:
+		return cStoI(value);
+	case PropertyValueType::Bool:
+		return parseBool(value);
+	case PropertyValueType::String:
+	default:
+		return StringInterner::intern(value);
+	}
+}
+
+Object::PropertyValueType Object::getSlotValueType(Property prop) const
+{
+	if ((textMask & (PropertyMask(1) << std::size_t(prop))) != 0)
+	{
+		return PropertyValueType::String;
+	}
+
+	return getPropertyValueType(type, prop);
+}
+
+sf::Int32 Object::encodePropertyText(PropertyValueType valueType, const std::string & value, bool & isText)
+{
+	sf::Int32 slot = encodePropertyValue(valueType, value);
+	isText = valueType != PropertyValueType::String && decodePropertyValue(valueType, slot) != value;
+
+	return isText ? StringInterner::intern(value) : slot;
+}
+
+std::string Object::decodePropertyValue(PropertyValueType valueType, sf::Int32 value)
+{
+	switch (valueType)
+	{
+	case PropertyValueType::Int:
+	case PropertyValueType::Bool:
+		return cNtoS(value);
+	case PropertyValueType::String:
+	default:
+		return StringInterner::getString(value);
+	}
+}
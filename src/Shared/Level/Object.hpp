@@ -1,7 +1,11 @@
 #ifndef SRC_SHARED_LEVEL_OBJECT_HPP_
 #define SRC_SHARED_LEVEL_OBJECT_HPP_
 
+#include <SFML/Config.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <Shared/Utils/StringInterner.hpp>
+#include <array>
+#include <cstddef>
 #include <map>
 #include <string>
 
@@ -74,21 +78,35 @@ public:
 	
 	void setPropertyInt(Property prop, int value);
 	void setPropertyString(Property prop, std::string value);
+	void setPropertySymbol(Property prop, StringInterner::Symbol symbol);
 	void unsetProperty(Property prop);
 	
 	bool hasProperty(Property prop) const;
 	
 	int getPropertyInt(Property prop) const;
 	std::string getPropertyString(Property prop) const;
-	const std::map<Property, std::string> & getAllProperties() const;
+	
+	/**
+	 * Returns the interned value of the specified property. For string properties, this is a plain slot read and can
+	 * be used for fast comparisons and lookups. Numeric properties are formatted and looked up in the interner instead,
+	 * which is slower and returns StringInterner::InvalidSymbol if their text has never been interned.
+	 */
+	StringInterner::Symbol getPropertySymbol(Property prop) const;
 	
 	ID getID() const;
 	
 	static const char * getTypeName(Type type);
 	static const char * getTypeNamePlural(Type type);
 	
+	/**
+	 * Returns the object type with the specified (singular or plural) name, or Type::None if there is no such type.
+	 */
+	static Type getTypeByName(const char * typeName);
+	static Type getTypeByNamePlural(const char * typeName);
+	
 	static const char * getPropertyName(Property prop);
 	static Property getPropertyByName(const char * propName);
+	static Property getPropertyByName(const char * propName, std::size_t length);
 	
 	static PropertyValueType getPropertyValueType(Type type, Property property);
 	static const std::map<Property, std::string> & getDefaultProperties(Type type);
@@ -100,9 +118,44 @@ private:
 	void setObserver(ObjectObserver * observer);
 	ObjectObserver * getObserver() const;
 	
+	/**
+	 * Stores a raw slot value for the specified property, marks it as present and notifies the observer. If isText is
+	 * true, the slot holds the symbol of the property's original text instead of a value of its value type.
+	 */
+	void setPropertySlot(Property prop, sf::Int32 value, bool isText = false);
+	
+	/**
+	 * Returns the type of the value stored in the slot of the specified property: String for text slots, the
+	 * property's value type otherwise.
+	 */
+	PropertyValueType getSlotValueType(Property prop) const;
+	
+	/**
+	 * Converts between the textual representation of a property and its raw slot value, depending on the slot type.
+	 * String slots hold the symbol of the interned string.
+	 */
+	static sf::Int32 encodePropertyValue(PropertyValueType valueType, const std::string & value);
+	static std::string decodePropertyValue(PropertyValueType valueType, sf::Int32 value);
+	
+	/**
+	 * Encodes a property value for a slot of the specified type. Numeric values that would not be decoded to the same
+	 * text (such as "007" or "True") are interned as text instead, so that they are saved unchanged. isText is set
+	 * accordingly.
+	 */
+	static sf::Int32 encodePropertyText(PropertyValueType valueType, const std::string & value, bool & isText);
+	
+	typedef sf::Uint16 PropertyMask;
+	
+	static_assert(std::size_t(Property::Count) <= sizeof(PropertyMask) * 8, "Property mask too small");
+	
 	sf::Vector2i position;
 	Type type;
-	std::map<Property, std::string> properties;
+	
+	std::array<sf::Int32, std::size_t(Property::Count)> propertySlots;
+	PropertyMask propertyMask;
+	
+	// Properties with a numeric value type whose slot holds their original text (see encodePropertyText()).
+	PropertyMask textMask;
 	
 	ObjectObserver * observer;
 	ID id;
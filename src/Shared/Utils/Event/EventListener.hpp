@@ -1,9 +1,34 @@
 #ifndef EVENT_LISTENER_HPP
 #define EVENT_LISTENER_HPP
 
+#include "Shared/Utils/Event/EventStatistics.hpp"
+
+#include <SFML/Config.hpp>
 #include <memory>
 #include <queue>
 
+/// queue shared between an event manager and one of its listeners.
+template <typename Event>
+struct EventQueue
+{
+	struct Entry
+	{
+		std::shared_ptr<const Event> event;
+		sf::Int64 pushTime;
+	};
+
+	EventQueue() :
+		connected(true)
+	{
+	}
+
+	std::queue<Entry> entries;
+	EventStatistics statistics;
+
+	/// false once the event manager has been destroyed.
+	bool connected;
+};
+
 /// a class that allows for shared listening for events.
 template <typename Event>
 class EventListener
@@ -24,26 +49,62 @@ public:
 
 	bool poll(Event & event)
 	{
-		if (!myEventQueue || myEventQueue->empty())
+		if (!myEventQueue || myEventQueue->entries.empty())
 		{
 			return false;
 		}
 		else
 		{
-			event = *myEventQueue->front();
-			myEventQueue->pop();
+			const typename EventQueue<Event>::Entry & entry = myEventQueue->entries.front();
+
+			if (myEventQueue->statistics.drained++ == 0)
+			{
+				myEventQueue->statistics.oldestPushTime = entry.pushTime;
+			}
+
+			event = *entry.event;
+			myEventQueue->entries.pop();
 			return true;
 		}
 	}
 
+	/// returns true if the listener was acquired from an event manager that still exists.
+	///
+	/// objects keyed by the address of an event source can use this to detect that the source was destroyed, even if
+	/// a new source has since been created at the same address.
+	bool isConnected() const
+	{
+		return myEventQueue && myEventQueue->connected;
+	}
+
+	/// returns the number of events waiting to be polled.
+	std::size_t getQueuedCount() const
+	{
+		return myEventQueue ? myEventQueue->entries.size() : 0;
+	}
+
+	/// returns the queue statistics accumulated since the last call, and starts a new accumulation period.
+	EventStatistics takeStatistics()
+	{
+		if (!myEventQueue)
+		{
+			return EventStatistics();
+		}
+
+		EventStatistics statistics = myEventQueue->statistics;
+		myEventQueue->statistics = EventStatistics();
+		myEventQueue->statistics.highWaterMark = myEventQueue->entries.size();
+		return statistics;
+	}
+
 private:
 
-	EventListener(std::shared_ptr<std::queue<std::shared_ptr<Event> > > queue)
+	EventListener(std::shared_ptr<EventQueue<Event> > queue)
 	{
 		myEventQueue = queue;
 	}
 
-	std::shared_ptr<std::queue<std::shared_ptr<Event> > > myEventQueue;
+	std::shared_ptr<EventQueue<Event> > myEventQueue;
 
 	template<typename>
 	friend class EventManager;
@@ -2,6 +2,10 @@
 #define EVENT_MANAGER_HPP
 
 #include "Shared/Utils/Event/EventListener.hpp"
+#include "Shared/Utils/Profiler.hpp"
+
+#include <algorithm>
+#include <vector>
 
 template<typename Event>
 class EventManager
@@ -11,8 +15,14 @@ public:
 	EventManager() = default;
 	EventManager(EventManager && other) = default;
 
+	~EventManager()
+	{
+		disconnectListeners();
+	}
+
 	EventManager & operator=(EventManager && other)
 	{
+		disconnectListeners();
 		myQueueList = std::move(other.myQueueList);
 		return *this;
 	}
@@ -20,37 +30,76 @@ public:
 	EventManager(const EventManager & other) = delete;
 	EventManager & operator=(const EventManager & other) = delete;
 
+	/// queues an event for all listeners.
+	///
+	/// an event that is identical to the most recently queued event of a listener is coalesced into it instead of
+	/// being queued again. this requires Event to be equality-comparable, and listeners to treat repeated events as
+	/// idempotent.
 	void push(Event event)
 	{
 		if (!myQueueList.empty())
 		{
-			std::shared_ptr<Event> eventPtr = std::make_shared<Event>(event);
+			std::shared_ptr<const Event> eventPtr;
+			sf::Int64 pushTime = 0;
 
 			for (auto it = myQueueList.begin(); it != myQueueList.end();)
 			{
-				if (it->expired())
+				std::shared_ptr<EventQueue<Event> > queue = it->lock();
+
+				if (!queue)
 				{
 					it = myQueueList.erase(it);
+					continue;
+				}
+
+				queue->statistics.pushed++;
+
+				if (!queue->entries.empty() && *queue->entries.back().event == event)
+				{
+					queue->statistics.coalesced++;
 				}
 				else
 				{
-					it->lock()->push(std::move(eventPtr));
-					it++;
+					// the event object and timestamp are shared between all listeners.
+					if (!eventPtr)
+					{
+						eventPtr = std::make_shared<const Event>(event);
+						pushTime = Profiler::getTimestamp();
+					}
+
+					queue->entries.push({ eventPtr, pushTime });
+					queue->statistics.highWaterMark = std::max(queue->statistics.highWaterMark,
+						queue->entries.size());
 				}
+
+				it++;
 			}
 		}
 	}
 
 	EventListener<Event> acquireListener()
 	{
-		auto newQueue = std::make_shared<std::queue<std::shared_ptr<Event> > >();
+		auto newQueue = std::make_shared<EventQueue<Event> >();
 		myQueueList.push_back(newQueue);
 		return EventListener<Event>(newQueue);
 	}
 
 private:
 
-	std::vector<std::weak_ptr<std::queue<std::shared_ptr<Event> > > > myQueueList;
+	void disconnectListeners()
+	{
+		for (const auto & weakQueue : myQueueList)
+		{
+			std::shared_ptr<EventQueue<Event> > queue = weakQueue.lock();
+
+			if (queue)
+			{
+				queue->connected = false;
+			}
+		}
+	}
+
+	std::vector<std::weak_ptr<EventQueue<Event> > > myQueueList;
 };
 
 #endif
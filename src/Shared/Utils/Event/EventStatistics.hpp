@@ -0,0 +1,36 @@
+#ifndef EVENT_STATISTICS_HPP
+#define EVENT_STATISTICS_HPP
+
+#include <SFML/Config.hpp>
+#include <cstddef>
+
+/// traffic through a single event listener's queue since the statistics were last taken.
+struct EventStatistics
+{
+	EventStatistics() :
+		pushed(0),
+		coalesced(0),
+		drained(0),
+		highWaterMark(0),
+		oldestPushTime(-1)
+	{
+	}
+
+	/// number of events pushed to the listener, including coalesced events.
+	std::size_t pushed;
+
+	/// number of events that were dropped because they were identical to the most recently queued event.
+	std::size_t coalesced;
+
+	/// number of events polled from the queue.
+	std::size_t drained;
+
+	/// largest number of events waiting in the queue at once.
+	std::size_t highWaterMark;
+
+	/// profiler timestamp (in microseconds) at which the first drained event was pushed, or -1 if no event was
+	/// drained. as the queue is processed in order, this is the oldest drained event.
+	sf::Int64 oldestPushTime;
+};
+
+#endif
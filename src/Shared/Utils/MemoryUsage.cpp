@@ -0,0 +1,156 @@
+#include "Shared/Utils/MemoryUsage.hpp"
+#include "Shared/Utils/StrNumCon.hpp"
+#include "Shared/Utils/Utilities.hpp"
+#include <algorithm>
+
+const std::size_t MemoryUsage::NodeOverhead;
+const std::size_t MemoryUsage::SharedOverhead;
+
+MemoryUsage::Entry::Entry() :
+	bytes(0),
+	count(0)
+{
+}
+
+MemoryUsage::MemoryUsage()
+{
+}
+
+void MemoryUsage::add(const std::string & name, std::size_t bytes, std::size_t count)
+{
+	Entry & entry = myEntries[name];
+	entry.name = name;
+	entry.bytes += bytes;
+	entry.count += count;
+}
+
+void MemoryUsage::add(const std::string & prefix, const MemoryUsage & usage)
+{
+	for (const auto & entry : usage.myEntries)
+	{
+		add(prefix + "/" + entry.first, entry.second.bytes, entry.second.count);
+	}
+}
+
+void MemoryUsage::clear()
+{
+	myEntries.clear();
+}
+
+std::size_t MemoryUsage::getTotalBytes() const
+{
+	std::size_t bytes = 0;
+
+	for (const auto & entry : myEntries)
+	{
+		bytes += entry.second.bytes;
+	}
+
+	return bytes;
+}
+
+std::size_t MemoryUsage::getTotalBytes(const std::string & prefix) const
+{
+	std::size_t bytes = 0;
+
+	// entries are sorted by name, so all entries with the prefix are adjacent.
+	for (auto it = myEntries.lower_bound(prefix); it != myEntries.end(); ++it)
+	{
+		if (it->first.compare(0, prefix.size(), prefix) != 0)
+		{
+			break;
+		}
+
+		if (it->first.size() == prefix.size() || it->first[prefix.size()] == '/')
+		{
+			bytes += it->second.bytes;
+		}
+	}
+
+	return bytes;
+}
+
+std::vector<MemoryUsage::Entry> MemoryUsage::getEntries() const
+{
+	std::vector<Entry> entries;
+	entries.reserve(myEntries.size());
+
+	for (const auto & entry : myEntries)
+	{
+		entries.push_back(entry.second);
+	}
+
+	return entries;
+}
+
+std::vector<MemoryUsage::Entry> MemoryUsage::getLargestEntries(std::size_t count) const
+{
+	std::vector<Entry> entries = getEntries();
+
+	count = std::min(count, entries.size());
+
+	std::partial_sort(entries.begin(), entries.begin() + count, entries.end(), [](const Entry & a, const Entry & b)
+	{
+		return a.bytes > b.bytes;
+	});
+
+	entries.resize(count);
+	return entries;
+}
+
+std::size_t MemoryUsage::getStringBytes(const std::string & string)
+{
+	const char * data = string.data();
+	const char * object = reinterpret_cast<const char *>(&string);
+
+	if (data >= object && data < object + sizeof(std::string))
+	{
+		return 0;
+	}
+
+	return string.capacity() + 1;
+}
+
+std::string formatMemoryUsage(const MemoryUsage & usage, std::size_t largestEntryCount)
+{
+	std::string output = "Total: " + getByteSizeString(usage.getTotalBytes()) + "\n";
+
+	// sum up top-level groups.
+	std::vector<std::pair<std::string, std::size_t> > groups;
+
+	for (const MemoryUsage::Entry & entry : usage.getEntries())
+	{
+		std::string group = entry.name.substr(0, entry.name.find('/'));
+
+		if (groups.empty() || groups.back().first != group)
+		{
+			groups.emplace_back(group, 0);
+		}
+
+		groups.back().second += entry.bytes;
+	}
+
+	for (const auto & group : groups)
+	{
+		output += "  " + group.first + ": " + getByteSizeString(group.second) + "\n";
+	}
+
+	if (largestEntryCount > 0)
+	{
+		output += "Largest:\n";
+
+		for (const MemoryUsage::Entry & entry : usage.getLargestEntries(largestEntryCount))
+		{
+			output += "  " + entry.name + ": " + getByteSizeString(entry.bytes);
+
+			if (entry.count != 0)
+			{
+				output += " (" + cNtoS(entry.count) + ")";
+			}
+
+			output += "\n";
+		}
+	}
+
+	return output;
+}
@@ -0,0 +1,82 @@
+#ifndef MEMORY_USAGE_HPP
+#define MEMORY_USAGE_HPP
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+// collects estimated memory usage of data structures, grouped into named entries.
+//
+// entry names are hierarchical, separated by "/" (for example "level 1/sections"). estimates cover the memory owned
+// by each structure, including container capacity and allocator bookkeeping for node-based containers, but not
+// memory shared with other structures.
+class MemoryUsage
+{
+
+public:
+
+	struct Entry
+	{
+		Entry();
+
+		std::string name;
+		std::size_t bytes;
+
+		// number of items (tiles, objects, vertices, widgets...) the memory is used for.
+		std::size_t count;
+	};
+
+	MemoryUsage();
+
+	// adds memory to the entry with the specified name, creating it if necessary.
+	void add(const std::string & name, std::size_t bytes, std::size_t count = 0);
+
+	// adds all entries of another memory usage object, prefixing their names with "prefix/".
+	void add(const std::string & prefix, const MemoryUsage & usage);
+
+	// removes all entries.
+	void clear();
+
+	std::size_t getTotalBytes() const;
+
+	// returns the sum of all entries whose name starts with "prefix/", or that are named "prefix".
+	std::size_t getTotalBytes(const std::string & prefix) const;
+
+	// returns all entries, sorted by name.
+	std::vector<Entry> getEntries() const;
+
+	// returns the entries with the highest memory usage, in descending order.
+	std::vector<Entry> getLargestEntries(std::size_t count) const;
+
+	// estimated size of a node of a map, set or list, excluding the stored value.
+	static const std::size_t NodeOverhead = 4 * sizeof(void*);
+
+	// estimated size of the heap block of a shared_ptr created by make_shared, excluding the stored value.
+	static const std::size_t SharedOverhead = 2 * sizeof(void*);
+
+	template<typename T>
+	static std::size_t getVectorBytes(const std::vector<T> & vector)
+	{
+		return vector.capacity() * sizeof(T);
+	}
+
+	template<typename K, typename V, typename C>
+	static std::size_t getMapBytes(const std::map<K, V, C> & map)
+	{
+		return map.size() * (sizeof(typename std::map<K, V, C>::value_type) + NodeOverhead);
+	}
+
+	// returns the heap memory owned by a string (0 for strings stored in the small string buffer).
+	static std::size_t getStringBytes(const std::string & string);
+
+private:
+
+	std::map<std::string, Entry> myEntries;
+};
+
+// returns a human-readable summary of a memory usage object: the total, one line per top-level group, and the largest
+// individual entries.
+std::string formatMemoryUsage(const MemoryUsage & usage, std::size_t largestEntryCount = 8);
+
+#endif
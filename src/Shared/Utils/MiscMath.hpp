@@ -5,8 +5,13 @@
 #include <cmath>
 #include <cstdlib>
 
+#include <SFML/Config.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#if defined(_MSC_VER) && defined(_WIN64)
+#include <intrin.h>
+#endif
+
 /// returns the absolute value of the given integer.
 template <typename T>
 inline T iAbs(T num)
@@ -164,6 +169,26 @@ inline int iPow(int base, unsigned int exp)
 	return n;
 }
 
+/// returns the number of trailing zero bits in a non-zero 64-bit integer.
+inline unsigned int countTrailingZeros(sf::Uint64 value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(value);
+#elif defined(_MSC_VER) && defined(_WIN64)
+	unsigned long index;
+	_BitScanForward64(&index, value);
+	return index;
+#else
+	unsigned int count = 0;
+	while (!(value & 1))
+	{
+		value >>= 1;
+		++count;
+	}
+	return count;
+#endif
+}
+
 inline bool getBarycentricCoords(sf::Vector2f pos, sf::Vector2f t1, sf::Vector2f t2, sf::Vector2f t3, float & b1, float & b2, float & b3)
 {
 	float dy2y3 = t2.y - t3.y;
@@ -0,0 +1,150 @@
+#ifndef NAME_LOOKUP_HPP
+#define NAME_LOOKUP_HPP
+
+#include <SFML/Config.hpp>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+// maps a fixed set of names to values using a perfect hash table that is built
+// once on construction. a lookup hashes the name and performs at most one
+// string comparison, so unknown names are rejected as quickly as known names
+// are found.
+template<typename T>
+class NameLookup
+{
+
+public:
+
+	// builds the lookup table. duplicate names are ignored after their first
+	// occurrence.
+	NameLookup(const std::vector<std::pair<std::string, T> > & entries, T invalidValue);
+
+	// returns the value for the specified name, or the invalid value if the
+	// name is unknown.
+	T find(const char * name) const;
+	T find(const char * name, std::size_t length) const;
+	T find(const std::string & name) const;
+
+private:
+
+	struct Entry
+	{
+		Entry() : used(false), value() {}
+
+		bool used;
+		std::string name;
+		T value;
+	};
+
+	static sf::Uint32 hash(const char * name, std::size_t length, sf::Uint32 seed);
+
+	bool tryBuild(const std::vector<std::pair<std::string, T> > & entries, std::size_t tableSize, sf::Uint32 seed);
+
+	std::vector<Entry> myTable;
+	sf::Uint32 mySeed;
+	T myInvalidValue;
+};
+
+template<typename T>
+NameLookup<T>::NameLookup(const std::vector<std::pair<std::string, T> > & entries, T invalidValue) :
+	mySeed(0),
+	myInvalidValue(invalidValue)
+{
+	// remove duplicate names so that a collision-free table always exists.
+	std::vector<std::pair<std::string, T> > uniqueEntries;
+	for (const auto & entry : entries)
+	{
+		bool duplicate = false;
+		for (const auto & uniqueEntry : uniqueEntries)
+		{
+			duplicate = duplicate || uniqueEntry.first == entry.first;
+		}
+		if (!duplicate)
+			uniqueEntries.push_back(entry);
+	}
+
+	// start with a table at least twice as large as the entry count, then
+	// search for a seed that maps all names to distinct slots. grow the table
+	// if no seed is found quickly.
+	std::size_t tableSize = 1;
+	while (tableSize < uniqueEntries.size() * 2)
+		tableSize *= 2;
+
+	while (true)
+	{
+		for (sf::Uint32 seed = 1; seed <= 1024; ++seed)
+		{
+			if (tryBuild(uniqueEntries, tableSize, seed))
+				return;
+		}
+		tableSize *= 2;
+	}
+}
+
+template<typename T>
+T NameLookup<T>::find(const char * name) const
+{
+	return find(name, std::strlen(name));
+}
+
+template<typename T>
+T NameLookup<T>::find(const char * name, std::size_t length) const
+{
+	const Entry & entry = myTable[hash(name, length, mySeed) & (myTable.size() - 1)];
+
+	if (entry.used && entry.name.size() == length && std::memcmp(entry.name.data(), name, length) == 0)
+		return entry.value;
+
+	return myInvalidValue;
+}
+
+template<typename T>
+T NameLookup<T>::find(const std::string & name) const
+{
+	return find(name.data(), name.size());
+}
+
+template<typename T>
+sf::Uint32 NameLookup<T>::hash(const char * name, std::size_t length, sf::Uint32 seed)
+{
+	// seeded FNV-1a, followed by a final avalanche step so that the seed
+	// affects all output bits.
+	sf::Uint32 value = 2166136261u ^ (seed * 0x9E3779B9u);
+	for (std::size_t i = 0; i < length; ++i)
+	{
+		value ^= (unsigned char) name[i];
+		value *= 16777619u;
+	}
+	value ^= value >> 16;
+	value *= 0x85EBCA6Bu;
+	value ^= value >> 13;
+	return value;
+}
+
+template<typename T>
+bool NameLookup<T>::tryBuild(const std::vector<std::pair<std::string, T> > & entries, std::size_t tableSize,
+		sf::Uint32 seed)
+{
+	std::vector<Entry> table(tableSize);
+
+	for (const auto & entry : entries)
+	{
+		Entry & slot = table[hash(entry.first.data(), entry.first.size(), seed) & (tableSize - 1)];
+
+		if (slot.used)
+			return false;
+
+		slot.used = true;
+		slot.name = entry.first;
+		slot.value = entry.second;
+	}
+
+	myTable = std::move(table);
+	mySeed = seed;
+	return true;
+}
+
+#endif
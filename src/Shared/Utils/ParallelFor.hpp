@@ -0,0 +1,68 @@
+#ifndef PARALLEL_FOR_HPP
+#define PARALLEL_FOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// calls func(i) for each i in [0, count), distributing the indices across up
+// to maxThreads worker threads (0 = hardware concurrency). blocks until all
+// calls are finished. if any call throws, the first exception is rethrown
+// after all workers have stopped.
+template<typename Func>
+void parallelFor(std::size_t count, Func func, std::size_t maxThreads = 0)
+{
+	if (maxThreads == 0)
+		maxThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+	std::size_t threadCount = std::min(count, maxThreads);
+
+	if (threadCount <= 1)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			func(i);
+		return;
+	}
+
+	std::atomic<std::size_t> nextIndex(0);
+	std::exception_ptr exception;
+	std::mutex exceptionMutex;
+
+	auto worker = [&]()
+	{
+		std::size_t index;
+		while ((index = nextIndex++) < count)
+		{
+			try
+			{
+				func(index);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(exceptionMutex);
+				if (!exception)
+					exception = std::current_exception();
+				nextIndex = count;
+			}
+		}
+	};
+
+	// the calling thread works as well.
+	std::vector<std::thread> threads;
+	for (std::size_t i = 1; i < threadCount; ++i)
+		threads.emplace_back(worker);
+
+	worker();
+
+	for (auto & thread : threads)
+		thread.join();
+
+	if (exception)
+		std::rethrow_exception(exception);
+}
+
+#endif
@@ -0,0 +1,520 @@
+#include "Shared/Utils/Profiler.hpp"
+#include <SFML/System/Clock.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace profilerPriv
+{
+
+struct Record
+{
+	const char * name;
+	sf::Int64 startTime;
+	sf::Int64 endTime;
+};
+
+struct CounterRecord
+{
+	const char * name;
+	sf::Int64 value;
+	bool isMaximum;
+};
+
+struct TraceRecord
+{
+	Record record;
+	std::size_t threadIndex;
+};
+
+struct CounterTraceRecord
+{
+	const char * name;
+	sf::Int64 time;
+	sf::Int64 value;
+};
+
+// zone and counter records of a single thread. the mutex is only contended while nextFrame() swaps the records out.
+// the buffer is shared between the thread and the buffer list. once the thread exits, nextFrame() drains and removes
+// it.
+struct ThreadBuffer
+{
+	std::mutex mutex;
+	std::vector<Record> records;
+	std::vector<CounterRecord> counters;
+	std::size_t threadIndex;
+};
+
+struct ZoneAccumulator
+{
+	ZoneAccumulator() :
+		calls(0),
+		totalTime(0),
+		maxTime(0),
+		histogram()
+	{
+	}
+
+	std::size_t calls;
+	sf::Int64 totalTime;
+	sf::Int64 maxTime;
+	std::array<std::size_t, Profiler::HistogramBucketCount> histogram;
+};
+
+struct CounterAccumulator
+{
+	CounterAccumulator() :
+		total(0),
+		maxPerFrame(0)
+	{
+	}
+
+	sf::Int64 total;
+	sf::Int64 maxPerFrame;
+};
+
+std::atomic<bool> enabled(false);
+std::atomic<bool> tracing(false);
+
+sf::Clock & getClock()
+{
+	static sf::Clock clock;
+	return clock;
+}
+
+// protects the buffer list, the trace and the statistics.
+std::mutex & getMutex()
+{
+	static std::mutex mutex;
+	return mutex;
+}
+
+std::vector<std::shared_ptr<ThreadBuffer> > & getBuffers()
+{
+	static std::vector<std::shared_ptr<ThreadBuffer> > buffers;
+	return buffers;
+}
+
+std::vector<TraceRecord> & getTrace()
+{
+	static std::vector<TraceRecord> trace;
+	return trace;
+}
+
+std::vector<CounterTraceRecord> & getCounterTrace()
+{
+	static std::vector<CounterTraceRecord> trace;
+	return trace;
+}
+
+std::unordered_map<const char *, ZoneAccumulator> & getAccumulators()
+{
+	static std::unordered_map<const char *, ZoneAccumulator> accumulators;
+	return accumulators;
+}
+
+std::unordered_map<const char *, CounterAccumulator> & getCounterAccumulators()
+{
+	static std::unordered_map<const char *, CounterAccumulator> accumulators;
+	return accumulators;
+}
+
+std::size_t getTraceSize()
+{
+	return getTrace().size() + getCounterTrace().size();
+}
+
+Profiler::Statistics & getPublishedStatistics()
+{
+	static Profiler::Statistics statistics;
+	return statistics;
+}
+
+std::size_t accumulatedFrames = 0;
+sf::Int64 windowStartTime = 0;
+
+// thread indices are not reused after a thread's buffer is removed, so that trace records stay distinguishable.
+std::size_t nextThreadIndex = 0;
+
+ThreadBuffer & getThreadBuffer()
+{
+	thread_local std::shared_ptr<ThreadBuffer> buffer;
+
+	if (buffer == nullptr)
+	{
+		buffer = std::make_shared<ThreadBuffer>();
+
+		std::lock_guard<std::mutex> lock(getMutex());
+		buffer->threadIndex = nextThreadIndex++;
+		getBuffers().push_back(buffer);
+	}
+
+	return *buffer;
+}
+
+void publishStatistics(sf::Int64 now)
+{
+	Profiler::Statistics & statistics = getPublishedStatistics();
+
+	// zones with the same name may be recorded through different string literals: merge them by name.
+	std::map<std::string, Profiler::ZoneStatistics> zones;
+
+	for (const auto & entry : getAccumulators())
+	{
+		Profiler::ZoneStatistics & zone = zones[entry.first];
+		zone.name = entry.first;
+		zone.calls += entry.second.calls;
+		zone.totalTime += sf::microseconds(entry.second.totalTime);
+		zone.maxTime = std::max(zone.maxTime, sf::microseconds(entry.second.maxTime));
+
+		for (std::size_t i = 0; i < Profiler::HistogramBucketCount; ++i)
+		{
+			zone.histogram[i] += entry.second.histogram[i];
+		}
+	}
+
+	std::map<std::string, Profiler::CounterStatistics> counters;
+
+	for (const auto & entry : getCounterAccumulators())
+	{
+		Profiler::CounterStatistics & counter = counters[entry.first];
+		counter.name = entry.first;
+		counter.total += entry.second.total;
+		counter.maxPerFrame = std::max(counter.maxPerFrame, entry.second.maxPerFrame);
+	}
+
+	statistics.index++;
+	statistics.frameCount = accumulatedFrames;
+	statistics.frameTime = sf::microseconds(now - windowStartTime);
+	statistics.zones.clear();
+	statistics.counters.clear();
+
+	for (auto & zone : zones)
+	{
+		statistics.zones.push_back(std::move(zone.second));
+	}
+
+	for (auto & counter : counters)
+	{
+		statistics.counters.push_back(std::move(counter.second));
+	}
+
+	getAccumulators().clear();
+	getCounterAccumulators().clear();
+	accumulatedFrames = 0;
+	windowStartTime = now;
+}
+
+void appendJSONString(std::string & output, const char * str)
+{
+	output += '"';
+
+	for (; *str != 0; ++str)
+	{
+		switch (*str)
+		{
+		case '"':
+			output += "\\\"";
+			break;
+		case '\\':
+			output += "\\\\";
+			break;
+		default:
+			if (static_cast<unsigned char>(*str) >= 0x20)
+			{
+				output += *str;
+			}
+			break;
+		}
+	}
+
+	output += '"';
+}
+
+}
+
+const std::size_t Profiler::HistogramBucketCount;
+const std::size_t Profiler::StatisticsFrameCount;
+const std::size_t Profiler::MaxTraceRecords;
+
+Profiler::ZoneStatistics::ZoneStatistics() :
+	calls(0),
+	histogram()
+{
+}
+
+Profiler::CounterStatistics::CounterStatistics() :
+	total(0),
+	maxPerFrame(0)
+{
+}
+
+Profiler::Statistics::Statistics() :
+	index(0),
+	frameCount(0)
+{
+}
+
+void Profiler::setEnabled(bool enabled)
+{
+	profilerPriv::enabled = enabled;
+}
+
+bool Profiler::isEnabled()
+{
+	return profilerPriv::enabled;
+}
+
+void Profiler::nextFrame()
+{
+	using namespace profilerPriv;
+
+	std::vector<Record> records;
+	std::vector<CounterRecord> counterRecords;
+
+	// counter values of this frame, summed (or maximized) over all threads.
+	std::unordered_map<const char *, sf::Int64> frameCounters;
+
+	std::lock_guard<std::mutex> lock(getMutex());
+
+	std::vector<std::shared_ptr<ThreadBuffer> > & buffers = getBuffers();
+
+	for (auto it = buffers.begin(); it != buffers.end();)
+	{
+		const std::shared_ptr<ThreadBuffer> & buffer = *it;
+
+		// only the buffer list still refers to the buffer of an exited thread, which can no longer add records. check
+		// before draining, so that records added right before the thread exits are not lost.
+		bool threadExited = buffer.use_count() == 1;
+
+		{
+			std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+			records.swap(buffer->records);
+			counterRecords.swap(buffer->counters);
+		}
+
+		for (const CounterRecord & record : counterRecords)
+		{
+			auto inserted = frameCounters.emplace(record.name, record.value);
+
+			if (!inserted.second)
+			{
+				sf::Int64 & value = inserted.first->second;
+				value = record.isMaximum ? std::max(value, record.value) : value + record.value;
+			}
+		}
+
+		for (const Record & record : records)
+		{
+			ZoneAccumulator & accumulator = getAccumulators()[record.name];
+			sf::Int64 duration = record.endTime - record.startTime;
+
+			accumulator.calls++;
+			accumulator.totalTime += duration;
+			accumulator.maxTime = std::max(accumulator.maxTime, duration);
+			accumulator.histogram[getHistogramBucket(duration)]++;
+
+			if (tracing && getTraceSize() < MaxTraceRecords)
+			{
+				getTrace().push_back({ record, buffer->threadIndex });
+			}
+		}
+
+		records.clear();
+		counterRecords.clear();
+
+		if (threadExited)
+		{
+			it = buffers.erase(it);
+			continue;
+		}
+
+		// keep the allocated capacity for the thread's next frame.
+		{
+			std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+			if (buffer->records.empty())
+			{
+				buffer->records.swap(records);
+			}
+			if (buffer->counters.empty())
+			{
+				buffer->counters.swap(counterRecords);
+			}
+		}
+
+		++it;
+	}
+
+	sf::Int64 frameEndTime = getTimestamp();
+
+	for (const auto & entry : frameCounters)
+	{
+		CounterAccumulator & accumulator = getCounterAccumulators()[entry.first];
+		accumulator.total += entry.second;
+		accumulator.maxPerFrame = std::max(accumulator.maxPerFrame, entry.second);
+
+		if (tracing && getTraceSize() < MaxTraceRecords)
+		{
+			getCounterTrace().push_back({ entry.first, frameEndTime, entry.second });
+		}
+	}
+
+	if (++accumulatedFrames >= StatisticsFrameCount)
+	{
+		publishStatistics(frameEndTime);
+	}
+}
+
+Profiler::Statistics Profiler::getStatistics()
+{
+	std::lock_guard<std::mutex> lock(profilerPriv::getMutex());
+	return profilerPriv::getPublishedStatistics();
+}
+
+std::size_t Profiler::getStatisticsIndex()
+{
+	std::lock_guard<std::mutex> lock(profilerPriv::getMutex());
+	return profilerPriv::getPublishedStatistics().index;
+}
+
+void Profiler::startTrace()
+{
+	std::lock_guard<std::mutex> lock(profilerPriv::getMutex());
+	profilerPriv::getTrace().clear();
+	profilerPriv::getCounterTrace().clear();
+	profilerPriv::tracing = true;
+	profilerPriv::enabled = true;
+}
+
+void Profiler::stopTrace()
+{
+	profilerPriv::tracing = false;
+}
+
+bool Profiler::isTracing()
+{
+	return profilerPriv::tracing;
+}
+
+std::size_t Profiler::getTraceRecordCount()
+{
+	std::lock_guard<std::mutex> lock(profilerPriv::getMutex());
+	return profilerPriv::getTraceSize();
+}
+
+std::string Profiler::getChromeTrace()
+{
+	using namespace profilerPriv;
+
+	std::lock_guard<std::mutex> lock(getMutex());
+
+	std::string output = "{\"traceEvents\":[\n";
+	char buffer[128];
+
+	std::size_t remaining = getTraceSize();
+
+	for (const TraceRecord & trace : getTrace())
+	{
+		output += "{\"name\":";
+		appendJSONString(output, trace.record.name);
+		std::snprintf(buffer, sizeof(buffer), ",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%zu}",
+				static_cast<long long>(trace.record.startTime),
+				static_cast<long long>(trace.record.endTime - trace.record.startTime), trace.threadIndex);
+		output += buffer;
+		output += --remaining > 0 ? ",\n" : "\n";
+	}
+
+	for (const CounterTraceRecord & trace : getCounterTrace())
+	{
+		output += "{\"name\":";
+		appendJSONString(output, trace.name);
+		std::snprintf(buffer, sizeof(buffer), ",\"ph\":\"C\",\"ts\":%lld,\"pid\":1,\"args\":{\"value\":%lld}}",
+				static_cast<long long>(trace.time), static_cast<long long>(trace.value));
+		output += buffer;
+		output += --remaining > 0 ? ",\n" : "\n";
+	}
+
+	output += "],\"displayTimeUnit\":\"ms\"}\n";
+	return output;
+}
+
+bool Profiler::saveChromeTrace(const std::string & filename)
+{
+	std::ofstream file(filename, std::ios::binary);
+
+	if (!file)
+	{
+		return false;
+	}
+
+	std::string trace = getChromeTrace();
+	file.write(trace.data(), trace.size());
+	return file.good();
+}
+
+std::size_t Profiler::getHistogramBucket(sf::Int64 microseconds)
+{
+	std::size_t bucket = 0;
+
+	while (bucket + 1 < HistogramBucketCount && microseconds >= (sf::Int64(1) << bucket))
+	{
+		bucket++;
+	}
+
+	return bucket;
+}
+
+void Profiler::count(const char * name, sf::Int64 value)
+{
+	if (!isEnabled())
+	{
+		return;
+	}
+
+	profilerPriv::ThreadBuffer & buffer = profilerPriv::getThreadBuffer();
+	std::lock_guard<std::mutex> lock(buffer.mutex);
+	buffer.counters.push_back({ name, value, false });
+}
+
+void Profiler::countMax(const char * name, sf::Int64 value)
+{
+	if (!isEnabled())
+	{
+		return;
+	}
+
+	profilerPriv::ThreadBuffer & buffer = profilerPriv::getThreadBuffer();
+	std::lock_guard<std::mutex> lock(buffer.mutex);
+	buffer.counters.push_back({ name, value, true });
+}
+
+sf::Int64 Profiler::getTimestamp()
+{
+	return profilerPriv::getClock().getElapsedTime().asMicroseconds();
+}
+
+void Profiler::record(const char * name, sf::Int64 startTime, sf::Int64 endTime)
+{
+	profilerPriv::ThreadBuffer & buffer = profilerPriv::getThreadBuffer();
+	std::lock_guard<std::mutex> lock(buffer.mutex);
+	buffer.records.push_back({ name, startTime, endTime });
+}
+
+ProfileZone::ProfileZone(const char * name) :
+	myName(Profiler::isEnabled() ? name : nullptr),
+	myStartTime(myName != nullptr ? Profiler::getTimestamp() : 0)
+{
+}
+
+ProfileZone::~ProfileZone()
+{
+	if (myName != nullptr)
+	{
+		Profiler::record(myName, myStartTime, Profiler::getTimestamp());
+	}
+}
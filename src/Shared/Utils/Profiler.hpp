@@ -0,0 +1,141 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <SFML/Config.hpp>
+#include <SFML/System/Time.hpp>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// collects timings of named code zones (see ProfileZone) and per-frame values of named counters (see count()).
+//
+// zones are recorded into per-thread buffers without synchronization between threads. once per frame, the main loop
+// calls nextFrame(), which gathers all buffers, accumulates per-zone statistics and, while a trace is being
+// captured, keeps the individual zone records for export in the chrome trace event format (chrome://tracing).
+//
+// recording is disabled by default. a disabled zone costs a single flag check.
+class Profiler
+{
+
+public:
+
+	// number of histogram buckets. bucket i counts zone calls shorter than 2^i microseconds, the last bucket counts
+	// all longer calls.
+	static const std::size_t HistogramBucketCount = 16;
+
+	// number of frames over which statistics are accumulated before they are published.
+	static const std::size_t StatisticsFrameCount = 60;
+
+	// maximum number of zone records kept in a trace. recording stops silently when the limit is reached.
+	static const std::size_t MaxTraceRecords = 1 << 20;
+
+	struct ZoneStatistics
+	{
+		ZoneStatistics();
+
+		std::string name;
+		std::size_t calls;
+		sf::Time totalTime;
+		sf::Time maxTime;
+		std::array<std::size_t, HistogramBucketCount> histogram;
+	};
+
+	struct CounterStatistics
+	{
+		CounterStatistics();
+
+		std::string name;
+
+		// sum of all per-frame values, and the largest per-frame value. a frame's value is the sum of the values
+		// counted within the frame, or their maximum for counters recorded with countMax().
+		sf::Int64 total;
+		sf::Int64 maxPerFrame;
+	};
+
+	struct Statistics
+	{
+		Statistics();
+
+		// incremented each time new statistics are published.
+		std::size_t index;
+
+		// number of frames the statistics were accumulated over, and their total duration.
+		std::size_t frameCount;
+		sf::Time frameTime;
+
+		// per-zone statistics, sorted by zone name.
+		std::vector<ZoneStatistics> zones;
+
+		// per-counter statistics, sorted by counter name.
+		std::vector<CounterStatistics> counters;
+	};
+
+	// enables or disables zone recording.
+	static void setEnabled(bool enabled);
+	static bool isEnabled();
+
+	// marks the end of a frame. gathers all recorded zones. must only be called from one thread.
+	static void nextFrame();
+
+	// returns the statistics of the last completed accumulation window.
+	static Statistics getStatistics();
+
+	// returns the index of the last published statistics, to check for updates without copying them.
+	static std::size_t getStatisticsIndex();
+
+	// starts capturing zone records for a trace, discarding any previous trace. enables recording.
+	static void startTrace();
+
+	// stops capturing zone records. the captured trace is kept for export.
+	static void stopTrace();
+
+	static bool isTracing();
+
+	// returns the number of zone and counter records in the current trace.
+	static std::size_t getTraceRecordCount();
+
+	// returns the captured trace as a chrome trace event JSON document.
+	static std::string getChromeTrace();
+
+	// writes the captured trace to a file. returns false on failure.
+	static bool saveChromeTrace(const std::string & filename);
+
+	// returns the histogram bucket for a zone call of the specified duration.
+	static std::size_t getHistogramBucket(sf::Int64 microseconds);
+
+	// adds a value to a named counter for the current frame. the name must be a string literal (or otherwise outlive
+	// the profiler). does nothing while recording is disabled.
+	static void count(const char * name, sf::Int64 value);
+
+	// like count(), but keeps the largest value counted within a frame instead of their sum. for gauges such as queue
+	// sizes, which may be sampled any number of times per frame.
+	static void countMax(const char * name, sf::Int64 value);
+
+	// returns the profiler's clock time in microseconds.
+	static sf::Int64 getTimestamp();
+
+	// records a zone with explicit start and end times, for durations that do not fit a ProfileZone's scope.
+	static void record(const char * name, sf::Int64 startTime, sf::Int64 endTime);
+};
+
+// measures the time between its construction and destruction as a profiler zone.
+// the name must be a string literal (or otherwise outlive the profiler).
+class ProfileZone
+{
+
+public:
+
+	explicit ProfileZone(const char * name);
+	~ProfileZone();
+
+	ProfileZone(const ProfileZone &) = delete;
+	ProfileZone & operator=(const ProfileZone &) = delete;
+
+private:
+
+	const char * myName;
+	sf::Int64 myStartTime;
+};
+
+#endif
@@ -4,15 +4,15 @@
 namespace randomPriv
 {
 
-std::mt19937_64 generator;
+thread_local std::mt19937_64 generator;
 
-std::uniform_int_distribution<sf::Uint16>  dis8 = std::uniform_int_distribution<sf::Uint16>(0, 255);
-std::uniform_int_distribution<sf::Uint16> dis16 = std::uniform_int_distribution<sf::Uint16>();
-std::uniform_int_distribution<sf::Uint32> dis32 = std::uniform_int_distribution<sf::Uint32>();
-std::uniform_int_distribution<sf::Uint64> dis64 = std::uniform_int_distribution<sf::Uint64>();
-std::uniform_real_distribution<float>	 disF  = std::uniform_real_distribution<float>();
+thread_local std::uniform_int_distribution<sf::Uint16>  dis8 = std::uniform_int_distribution<sf::Uint16>(0, 255);
+thread_local std::uniform_int_distribution<sf::Uint16> dis16 = std::uniform_int_distribution<sf::Uint16>();
+thread_local std::uniform_int_distribution<sf::Uint32> dis32 = std::uniform_int_distribution<sf::Uint32>();
+thread_local std::uniform_int_distribution<sf::Uint64> dis64 = std::uniform_int_distribution<sf::Uint64>();
+thread_local std::uniform_real_distribution<float>	 disF  = std::uniform_real_distribution<float>();
 
-bool initialized = false;
+thread_local bool initialized = false;
 
 void init()
 {
@@ -21,6 +21,7 @@ void init()
 
 	std::random_device randomDevice;
 	generator.seed(randomDevice());
+	initialized = true;
 }
 
 }
@@ -55,3 +56,13 @@ float Random::generateNormFloat()
 	return randomPriv::disF(randomPriv::generator);
 }
 
+sf::Uint32 Random::generateBelow(sf::Uint32 count)
+{
+	randomPriv::init();
+	return std::uniform_int_distribution<sf::Uint32>(0, count - 1)(randomPriv::generator);
+}
+
+bool Random::generateChance(float probability)
+{
+	return generateNormFloat() < probability;
+}
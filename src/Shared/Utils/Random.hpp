@@ -3,6 +3,7 @@
 
 #include <SFML/Config.hpp>
 
+// each thread has its own generator, which is seeded from a random device on first use.
 class Random
 {
 public:
@@ -12,6 +13,12 @@ public:
 	static sf::Uint32 generate32();
 	static sf::Uint64 generate64();
 	static float generateNormFloat();
+
+	// returns a uniformly distributed integer in the range [0, count). count must be greater than 0.
+	static sf::Uint32 generateBelow(sf::Uint32 count);
+
+	// returns true with the specified probability.
+	static bool generateChance(float probability);
 };
 
 #endif
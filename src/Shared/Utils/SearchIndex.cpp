@@ -0,0 +1,93 @@
+#include "Shared/Utils/SearchIndex.hpp"
+#include "Shared/Utils/Utilities.hpp"
+
+SearchIndex::SearchIndex()
+{
+}
+
+SearchIndex::SearchIndex(const std::vector<std::string> & names)
+{
+	setNames(names);
+}
+
+void SearchIndex::setNames(const std::vector<std::string> & names)
+{
+	myNames.clear();
+	myTrigrams.clear();
+
+	myNames.reserve(names.size());
+
+	for (std::size_t i = 0; i < names.size(); ++i)
+	{
+		myNames.push_back(toLowercase(names[i]));
+		const std::string & name = myNames.back();
+
+		for (std::size_t pos = 0; pos + 3 <= name.size(); ++pos)
+		{
+			std::vector<std::size_t> & list = myTrigrams[getTrigram(name.data() + pos)];
+
+			// names containing a trigram more than once are only listed once.
+			if (list.empty() || list.back() != i)
+			{
+				list.push_back(i);
+			}
+		}
+	}
+}
+
+std::size_t SearchIndex::getNameCount() const
+{
+	return myNames.size();
+}
+
+void SearchIndex::find(const std::string & query, std::vector<std::size_t> & results) const
+{
+	results.clear();
+
+	std::string lowerQuery = toLowercase(query);
+
+	if (lowerQuery.size() < 3)
+	{
+		for (std::size_t i = 0; i < myNames.size(); ++i)
+		{
+			if (myNames[i].find(lowerQuery) != std::string::npos)
+			{
+				results.push_back(i);
+			}
+		}
+		return;
+	}
+
+	// every match contains all trigrams of the query: only check the names listed for the rarest one.
+	const std::vector<std::size_t> * candidates = nullptr;
+
+	for (std::size_t pos = 0; pos + 3 <= lowerQuery.size(); ++pos)
+	{
+		auto it = myTrigrams.find(getTrigram(lowerQuery.data() + pos));
+
+		if (it == myTrigrams.end())
+		{
+			return;
+		}
+
+		if (candidates == nullptr || it->second.size() < candidates->size())
+		{
+			candidates = &it->second;
+		}
+	}
+
+	for (std::size_t i : *candidates)
+	{
+		if (myNames[i].find(lowerQuery) != std::string::npos)
+		{
+			results.push_back(i);
+		}
+	}
+}
+
+SearchIndex::Trigram SearchIndex::getTrigram(const char * str)
+{
+	return Trigram(static_cast<unsigned char>(str[0])) << 16
+		| Trigram(static_cast<unsigned char>(str[1])) << 8
+		| Trigram(static_cast<unsigned char>(str[2]));
+}
@@ -0,0 +1,45 @@
+#ifndef SEARCH_INDEX_HPP
+#define SEARCH_INDEX_HPP
+
+#include <SFML/Config.hpp>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// finds all names in a fixed list that contain a search string, ignoring case.
+//
+// a trigram index is built once, so a query only compares the names that contain the query's rarest trigram instead
+// of every name in the list. queries shorter than a trigram fall back to a linear scan.
+class SearchIndex
+{
+
+public:
+
+	SearchIndex();
+
+	// builds the index for the specified names. the search results refer to their positions in the list.
+	explicit SearchIndex(const std::vector<std::string> & names);
+
+	// replaces the indexed names.
+	void setNames(const std::vector<std::string> & names);
+
+	std::size_t getNameCount() const;
+
+	// stores the positions of all names containing the query in ascending order. an empty query matches all names.
+	void find(const std::string & query, std::vector<std::size_t> & results) const;
+
+private:
+
+	typedef sf::Uint32 Trigram;
+
+	static Trigram getTrigram(const char * str);
+
+	// lowercase names.
+	std::vector<std::string> myNames;
+
+	// positions of the names containing each trigram, in ascending order.
+	std::unordered_map<Trigram, std::vector<std::size_t> > myTrigrams;
+};
+
+#endif
@@ -0,0 +1,37 @@
+#include "Shared/Utils/SeededRandom.hpp"
+
+SeededRandom::SeededRandom(sf::Uint64 seed) :
+	myEngine(seed)
+{
+}
+
+sf::Uint64 SeededRandom::generate64()
+{
+	return myEngine();
+}
+
+float SeededRandom::generateNormFloat()
+{
+	// the upper 24 bits fill a float's mantissa exactly.
+	return (generate64() >> 40) * (1.f / 16777216.f);
+}
+
+sf::Uint32 SeededRandom::generateBelow(sf::Uint32 count)
+{
+	// reject the lowest 2^64 % count values, so that every remainder is equally likely.
+	sf::Uint64 threshold = (sf::Uint64(0) - count) % count;
+	sf::Uint64 value;
+
+	do
+	{
+		value = generate64();
+	}
+	while (value < threshold);
+
+	return sf::Uint32(value % count);
+}
+
+bool SeededRandom::generateChance(float probability)
+{
+	return generateNormFloat() < probability;
+}
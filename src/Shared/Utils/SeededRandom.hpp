@@ -0,0 +1,34 @@
+#ifndef SEEDED_RANDOM_HPP
+#define SEEDED_RANDOM_HPP
+
+#include <SFML/Config.hpp>
+#include <random>
+
+// pseudo-random number generator whose output only depends on its seed.
+//
+// the std distributions used by Random are implementation-defined, so their results differ between standard
+// libraries. this class maps the raw output of std::mt19937_64, which the standard fully specifies, to ranges itself,
+// so a seed produces the same sequence on every platform.
+class SeededRandom
+{
+public:
+
+	explicit SeededRandom(sf::Uint64 seed);
+
+	sf::Uint64 generate64();
+
+	// returns a float in the range [0, 1).
+	float generateNormFloat();
+
+	// returns a uniformly distributed integer in the range [0, count). count must be greater than 0.
+	sf::Uint32 generateBelow(sf::Uint32 count);
+
+	// returns true with the specified probability.
+	bool generateChance(float probability);
+
+private:
+
+	std::mt19937_64 myEngine;
+};
+
+#endif
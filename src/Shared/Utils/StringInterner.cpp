@@ -0,0 +1,99 @@
+#include "Shared/Utils/StringInterner.hpp"
+#include "Shared/Utils/MemoryUsage.hpp"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace stringInternerPriv
+{
+
+// deque keeps element references stable while new strings are appended.
+std::deque<std::string> & getStrings()
+{
+	static std::deque<std::string> strings(1);
+	return strings;
+}
+
+std::unordered_map<std::string, StringInterner::Symbol> & getSymbols()
+{
+	static std::unordered_map<std::string, StringInterner::Symbol> symbols = { { "", StringInterner::EmptySymbol } };
+	return symbols;
+}
+
+std::mutex & getMutex()
+{
+	static std::mutex mutex;
+	return mutex;
+}
+
+}
+
+const StringInterner::Symbol StringInterner::EmptySymbol;
+const StringInterner::Symbol StringInterner::InvalidSymbol;
+
+StringInterner::Symbol StringInterner::intern(const std::string& str)
+{
+	using namespace stringInternerPriv;
+
+	std::lock_guard<std::mutex> lock(getMutex());
+
+	auto it = getSymbols().find(str);
+
+	if (it != getSymbols().end())
+	{
+		return it->second;
+	}
+
+	Symbol symbol = getStrings().size();
+	getStrings().push_back(str);
+	getSymbols().emplace(str, symbol);
+	return symbol;
+}
+
+StringInterner::Symbol StringInterner::find(const std::string& str)
+{
+	using namespace stringInternerPriv;
+
+	std::lock_guard<std::mutex> lock(getMutex());
+
+	auto it = getSymbols().find(str);
+	return it != getSymbols().end() ? it->second : InvalidSymbol;
+}
+
+const std::string& StringInterner::getString(Symbol symbol)
+{
+	using namespace stringInternerPriv;
+
+	std::lock_guard<std::mutex> lock(getMutex());
+
+	return symbol < getStrings().size() ? getStrings()[symbol] : getStrings()[EmptySymbol];
+}
+
+std::size_t StringInterner::getSymbolCount()
+{
+	using namespace stringInternerPriv;
+
+	std::lock_guard<std::mutex> lock(getMutex());
+
+	return getStrings().size();
+}
+
+void StringInterner::getMemoryUsage(MemoryUsage & usage)
+{
+	using namespace stringInternerPriv;
+
+	std::lock_guard<std::mutex> lock(getMutex());
+
+	std::size_t bytes = 0;
+
+	// each string is stored twice: once in the deque and once as a hash map key.
+	for (const std::string & str : getStrings())
+	{
+		bytes += sizeof(std::string) * 2 + MemoryUsage::getStringBytes(str) * 2;
+	}
+
+	bytes += getSymbols().size() * (sizeof(Symbol) + MemoryUsage::NodeOverhead);
+	bytes += getSymbols().bucket_count() * sizeof(void*);
+
+	usage.add("strings", bytes, getStrings().size());
+}
@@ -0,0 +1,42 @@
+#ifndef STRING_INTERNER_HPP
+#define STRING_INTERNER_HPP
+
+#include <SFML/Config.hpp>
+#include <cstddef>
+#include <string>
+
+class MemoryUsage;
+
+// global pool of unique strings, identified by 32-bit symbols.
+// interned strings live until program termination, so references returned by
+// getString() stay valid. all functions are thread-safe.
+class StringInterner
+{
+
+public:
+
+	typedef sf::Uint32 Symbol;
+
+	// symbol of the empty string, which is always interned.
+	static const Symbol EmptySymbol = 0;
+
+	// symbol returned by find() for strings that have not been interned.
+	static const Symbol InvalidSymbol = 0xFFFFFFFF;
+
+	// returns the symbol for the specified string, adding it to the pool if necessary.
+	static Symbol intern(const std::string & str);
+
+	// returns the symbol for the specified string without modifying the pool.
+	static Symbol find(const std::string & str);
+
+	// returns the string for the specified symbol, or an empty string for unknown symbols.
+	static const std::string & getString(Symbol symbol);
+
+	// returns the number of strings in the pool.
+	static std::size_t getSymbolCount();
+
+	// adds the estimated memory used by the pool to the memory usage object.
+	static void getMemoryUsage(MemoryUsage & usage);
+};
+
+#endif
@@ -19,6 +19,7 @@
 #include <vector>
 
 #if defined WOS_LINUX || defined WOS_OSX
+#	include <sys/resource.h>
 #	include <sys/stat.h>
 #	include <sys/types.h>
 #elif defined WOS_WINDOWS
@@ -217,6 +218,39 @@ std::string getTimeString()
 	return ret;
 }
 
+sf::Time getProcessCpuTime()
+{
+#if defined WOS_LINUX || defined WOS_OSX
+
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+	{
+		return sf::Time::Zero;
+	}
+
+	return sf::seconds(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+		+ sf::microseconds(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+
+#elif defined WOS_WINDOWS
+
+	FILETIME creationTime, exitTime, kernelTime, userTime;
+	if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+	{
+		return sf::Time::Zero;
+	}
+
+	// Filetimes are measured in 100 nanosecond intervals.
+	sf::Uint64 kernel = (sf::Uint64(kernelTime.dwHighDateTime) << 32) | kernelTime.dwLowDateTime;
+	sf::Uint64 user = (sf::Uint64(userTime.dwHighDateTime) << 32) | userTime.dwLowDateTime;
+	return sf::microseconds((kernel + user) / 10);
+
+#else
+
+	return sf::Time::Zero;
+
+#endif
+}
+
 bool fileExists(const std::string & filename)
 {
 	std::ifstream file;
@@ -284,6 +318,16 @@ std::string readFile(const std::string & filename)
 	return content;
 }
 
+sf::Uint64 getFileSize(const std::string & filename)
+{
+	std::ifstream file(filename, std::ios::binary | std::ios::ate);
+	if (!file)
+	{
+		return 0;
+	}
+	return file.tellg();
+}
+
 std::string getFileExtension(const std::string & filename)
 {
 	// no dot found in file name.
@@ -28,6 +28,9 @@ std::vector<std::string> extractSection(const std::vector<std::string> & vector,
 
 std::string getTimeString();
 
+// returns the CPU time used by all threads of this process so far.
+sf::Time getProcessCpuTime();
+
 // TODO: Place these functions in separate FileSystem namespace / header file.
 bool fileExists(const std::string & filename);
 
@@ -35,6 +38,7 @@ bool createDirectory(const std::string & path);
 bool createDirectoryStructure(const std::string & path);
 
 std::string readFile(const std::string & filename);
+sf::Uint64 getFileSize(const std::string & filename);
 
 std::string getFileExtension(const std::string & filename);
 std::string removeFileExtension(const std::string & filename);
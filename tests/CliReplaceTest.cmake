@@ -0,0 +1,37 @@
+# Runs necroedit-cli replace with an object type filter on a generated dungeon and checks that only objects of that
+# type are erased. Expects CLI (path of necroedit-cli) and WORK_DIR to be defined.
+
+set(DUNGEON "${WORK_DIR}/cli-replace-test.xml")
+
+function(run_cli OUTPUT_VARIABLE)
+	execute_process(COMMAND "${CLI}" ${ARGN} OUTPUT_VARIABLE output ERROR_VARIABLE error RESULT_VARIABLE result)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "necroedit-cli ${ARGN} failed (${result}):\n${output}${error}")
+	endif()
+	set(${OUTPUT_VARIABLE} "${output}" PARENT_SCOPE)
+endfunction()
+
+run_cli(output generate --seed 3 --size 32x32 --objects 0.2 --object-mix 1,1,0,0,0,0 "${DUNGEON}")
+if(NOT output MATCHES "\\(([1-9][0-9]*) traps, ([1-9][0-9]*) enemies,")
+	message(FATAL_ERROR "Generated dungeon lacks traps or enemies:\n${output}")
+endif()
+set(TRAPS ${CMAKE_MATCH_1})
+set(ENEMIES ${CMAKE_MATCH_2})
+
+run_cli(output replace --check --object-type enemy --erase-objects "${DUNGEON}")
+if(NOT output MATCHES ": 0 tiles, ${ENEMIES} objects matched")
+	message(FATAL_ERROR "Expected ${ENEMIES} matching enemies:\n${output}")
+endif()
+
+run_cli(output replace --object-type enemy --erase-objects "${DUNGEON}")
+run_cli(output stats "${DUNGEON}")
+if(NOT output MATCHES "\\(${TRAPS} traps, 0 enemies,")
+	message(FATAL_ERROR "Expected ${TRAPS} traps and no enemies after erasing enemies:\n${output}")
+endif()
+
+# The generator's --objects option must not be mistaken for a type filter.
+execute_process(COMMAND "${CLI}" replace --objects enemy --erase-objects "${DUNGEON}" RESULT_VARIABLE result
+	OUTPUT_QUIET ERROR_QUIET)
+if(result EQUAL 0)
+	message(FATAL_ERROR "replace accepted --objects")
+endif()
@@ -0,0 +1,133 @@
+#include "Suites.hpp"
+#include "Test.hpp"
+
+#include <Shared/Editor/BatchEdit.hpp>
+#include <Shared/Editor/DungeonGenerator.hpp>
+#include <Shared/Level/Dungeon.hpp>
+#include <Shared/Level/Level.hpp>
+#include <Shared/Level/Object.hpp>
+#include <cstddef>
+
+namespace
+{
+
+std::size_t countObjects(const Level & level)
+{
+	std::size_t count = 0;
+
+	for (auto it = level.objectsBegin(); it != level.objectsEnd(); ++it)
+	{
+		count++;
+	}
+
+	return count;
+}
+
+void fillLevel(Level & level, std::size_t objectCount)
+{
+	for (std::size_t i = 0; i < objectCount; ++i)
+	{
+		sf::Vector2i position(int(i % 7), int(i / 7));
+		level.addObject(position, i % 2 == 0 ? Object::Type::Enemy : Object::Type::Item);
+	}
+}
+
+void testRemoveAllObjects(TestRunner & runner)
+{
+	Level level;
+	fillLevel(level, 20);
+
+	// Remove from the front, so that the last object leaves a trail of empty slots behind it.
+	for (Object::ID id = 0; id < 20; ++id)
+	{
+		level.removeObject(id);
+	}
+
+	TEST_CHECK(runner, countObjects(level) == 0);
+	TEST_CHECK(runner, level.getObjectsAt(sf::Vector2i(0, 0)).empty());
+
+	// IDs are reused after the level has been emptied.
+	TEST_CHECK(runner, level.addObject(Object::Type::Trap) == 0);
+	TEST_CHECK(runner, countObjects(level) == 1);
+}
+
+void testBatchEraseWholeLevel(TestRunner & runner)
+{
+	Dungeon dungeon;
+	dungeon.insertLevel(0);
+	dungeon.insertLevel(1);
+	fillLevel(dungeon.getLevel(0), 50);
+	fillLevel(dungeon.getLevel(1), 3);
+
+	BatchEdit edit;
+	edit.setObjectAction(BatchEdit::ObjectAction::Erase);
+
+	BatchEdit::Result found = edit.find(dungeon);
+	TEST_CHECK(runner, found.objectCount == 53);
+	TEST_CHECK(runner, countObjects(dungeon.getLevel(0)) == 50);
+
+	BatchEdit::Result erased = edit.apply(dungeon);
+	TEST_CHECK(runner, erased.objectCount == 53);
+	TEST_CHECK(runner, erased.levelObjectCounts.size() == 2);
+	TEST_CHECK(runner, countObjects(dungeon.getLevel(0)) == 0);
+	TEST_CHECK(runner, countObjects(dungeon.getLevel(1)) == 0);
+
+	TEST_CHECK(runner, edit.find(dungeon).objectCount == 0);
+}
+
+
+void testBatchEraseObjectType(TestRunner & runner)
+{
+	Dungeon dungeon;
+	dungeon.insertLevel(0);
+	fillLevel(dungeon.getLevel(0), 21);
+
+	BatchEdit edit;
+	edit.setObjectTypeFilter(Object::Type::Enemy);
+	edit.setObjectAction(BatchEdit::ObjectAction::Erase);
+
+	TEST_CHECK(runner, edit.find(dungeon).objectCount == 11);
+	TEST_CHECK(runner, edit.apply(dungeon).objectCount == 11);
+
+	const Level & level = dungeon.getLevel(0);
+	TEST_CHECK(runner, countObjects(level) == 10);
+
+	for (auto it = level.objectsBegin(); it != level.objectsEnd(); ++it)
+	{
+		TEST_CHECK(runner, it->getType() == Object::Type::Item);
+	}
+}
+
+
+void testGeneratorSameSeed(TestRunner & runner)
+{
+	DungeonGenerator::Config config;
+	config.levelCount = 2;
+	config.levelSize = sf::Vector2i(24, 24);
+	config.objectDensity = 0.5f;
+
+	DungeonGenerator generator;
+	generator.setConfig(config);
+
+	Dungeon first, second;
+	generator.generate(first);
+	generator.generate(second);
+
+	TEST_CHECK(runner, first.saveToXMLString("test") == second.saveToXMLString("test"));
+	TEST_CHECK(runner, countObjects(first.getLevel(1)) > 0);
+
+	// A single level only depends on its own seed.
+	Level level;
+	generator.generateLevel(level, 1);
+	TEST_CHECK(runner, countObjects(level) == countObjects(first.getLevel(1)));
+}
+
+}
+
+void runLevelTests(TestRunner & runner)
+{
+	runner.run("Level/RemoveAllObjects", testRemoveAllObjects);
+	runner.run("BatchEdit/EraseWholeLevel", testBatchEraseWholeLevel);
+	runner.run("BatchEdit/EraseObjectType", testBatchEraseObjectType);
+	runner.run("DungeonGenerator/SameSeed", testGeneratorSameSeed);
+}
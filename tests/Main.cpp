@@ -0,0 +1,41 @@
+/*
+ * Unit tests for the core library.
+ *
+ * Usage: necroedit-tests [--filter <prefix>]
+ *
+ * Exits with code 1 if any test fails.
+ */
+
+#include "Suites.hpp"
+#include "Test.hpp"
+
+#include <cstdio>
+#include <string>
+
+int main(int argc, char ** argv)
+{
+	std::string filter;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+
+		if (arg == "--filter" && i + 1 < argc)
+		{
+			filter = argv[++i];
+		}
+		else
+		{
+			std::fprintf(stderr, "Usage: %s [--filter <prefix>]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	TestRunner runner(filter);
+
+	runLevelTests(runner);
+	runObjectTests(runner);
+	runUtilityTests(runner);
+
+	return runner.finish() ? 0 : 1;
+}
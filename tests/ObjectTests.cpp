@@ -0,0 +1,119 @@
+#include "Suites.hpp"
+#include "Test.hpp"
+
+#include <Shared/Level/Dungeon.hpp>
+#include <Shared/Level/Level.hpp>
+#include <Shared/Level/Object.hpp>
+#include <Shared/Utils/StringInterner.hpp>
+#include <string>
+
+namespace
+{
+
+void testPropertyTextRoundTrip(TestRunner & runner)
+{
+	Object chest(Object::Type::Chest);
+
+	// Numeric properties keep text that their numeric value would not reproduce...
+	chest.setPropertyString(Object::Property::Color, "007");
+	chest.setPropertyString(Object::Property::Hidden, "True");
+	chest.setPropertyString(Object::Property::SaleCost, "");
+	chest.setPropertyString(Object::Property::SingleChoice, "abc");
+
+	TEST_CHECK(runner, chest.getPropertyString(Object::Property::Color) == "007");
+	TEST_CHECK(runner, chest.getPropertyString(Object::Property::Hidden) == "True");
+	TEST_CHECK(runner, chest.getPropertyString(Object::Property::SaleCost) == "");
+	TEST_CHECK(runner, chest.getPropertyString(Object::Property::SingleChoice) == "abc");
+	StringInterner::Symbol colorSymbol = StringInterner::intern("007");
+	TEST_CHECK(runner, chest.getPropertySymbol(Object::Property::Color) == colorSymbol);
+
+	// ...but are still parsed as numbers.
+	TEST_CHECK(runner, chest.getPropertyInt(Object::Property::Color) == 7);
+	TEST_CHECK(runner, chest.getPropertyInt(Object::Property::Hidden) == 1);
+	TEST_CHECK(runner, chest.getPropertyInt(Object::Property::SaleCost) == 0);
+	TEST_CHECK(runner, chest.getPropertyInt(Object::Property::SingleChoice) == 0);
+
+	// Canonical values and integer assignments replace the text.
+	chest.setPropertyString(Object::Property::Color, "7");
+	chest.setPropertyInt(Object::Property::Hidden, 5);
+	TEST_CHECK(runner, chest.getPropertyString(Object::Property::Color) == "7");
+	TEST_CHECK(runner, chest.getPropertyString(Object::Property::Hidden) == "1");
+
+	Object copy(chest);
+	TEST_CHECK(runner, copy.getPropertyString(Object::Property::SingleChoice) == "abc");
+
+	// The type property of items is a string, so changing the object type converts it.
+	Object object(Object::Type::Enemy);
+	object.setPropertyString(Object::Property::Type, "0x10");
+	object.setType(Object::Type::Item);
+	TEST_CHECK(runner, object.getPropertyString(Object::Property::Type) == "0x10");
+	object.setType(Object::Type::Trap);
+	TEST_CHECK(runner, object.getPropertyString(Object::Property::Type) == "0x10");
+	TEST_CHECK(runner, object.getPropertyInt(Object::Property::Type) == 0);
+	object.setType(Object::Type::Item);
+	object.setPropertyString(Object::Property::Type, "12");
+	object.setType(Object::Type::Enemy);
+	TEST_CHECK(runner, object.getPropertyInt(Object::Property::Type) == 12);
+	StringInterner::Symbol typeSymbol = StringInterner::intern("12");
+	TEST_CHECK(runner, object.getPropertySymbol(Object::Property::Type) == typeSymbol);
+
+	// Reading the symbol of a numeric property does not intern its text.
+	std::size_t symbolCount = StringInterner::getSymbolCount();
+	object.setPropertyInt(Object::Property::Type, 918273);
+	TEST_CHECK(runner, object.getPropertySymbol(Object::Property::Type) == StringInterner::InvalidSymbol);
+	TEST_CHECK(runner, StringInterner::getSymbolCount() == symbolCount);
+
+	object.unsetProperty(Object::Property::Type);
+	object.setPropertyInt(Object::Property::Type, 3);
+	TEST_CHECK(runner, object.getPropertyString(Object::Property::Type) == "3");
+}
+
+void testDungeonPropertyRoundTrip(TestRunner & runner)
+{
+	const std::string xmlData = "<?xml version=\"1.0\"?>\n"
+			"<dungeon character=\"0\" name=\"test\" numLevels=\"1\">\n"
+			"\t<level bossNum=\"-1\" music=\"0\" num=\"1\">\n"
+			"\t\t<tiles>\n"
+			"\t\t\t<tile x=\"0\" y=\"0\" type=\"0\" zone=\"1\" torch=\"0\" cracked=\"0\" />\n"
+			"\t\t</tiles>\n"
+			"\t\t<traps>\n"
+			"\t\t\t<trap x=\"0\" y=\"0\" type=\"1\" subtype=\"007\" />\n"
+			"\t\t</traps>\n"
+			"\t\t<chests>\n"
+			"\t\t\t<chest x=\"0\" y=\"0\" color=\"1\" contents=\"no_item\" hidden=\"True\" saleCost=\"0\" "
+			"singleChoice=\"yes\" />\n"
+			"\t\t</chests>\n"
+			"\t</level>\n"
+			"</dungeon>\n";
+
+	Dungeon dungeon;
+	TEST_CHECK(runner, dungeon.loadFromXMLString(xmlData, "test.xml"));
+
+	std::string saved = dungeon.saveToXMLString("test.xml");
+	TEST_CHECK(runner, saved.find("subtype=\"007\"") != std::string::npos);
+	TEST_CHECK(runner, saved.find("hidden=\"True\"") != std::string::npos);
+	TEST_CHECK(runner, saved.find("singleChoice=\"yes\"") != std::string::npos);
+	TEST_CHECK(runner, saved.find("color=\"1\"") != std::string::npos);
+
+	const Level & level = dungeon.getLevel(0);
+	for (auto it = level.objectsBegin(); it != level.objectsEnd(); ++it)
+	{
+		if (it->getType() == Object::Type::Trap)
+		{
+			TEST_CHECK(runner, it->getPropertyInt(Object::Property::Subtype) == 7);
+		}
+		else if (it->getType() == Object::Type::Chest)
+		{
+			TEST_CHECK(runner, it->getPropertyInt(Object::Property::Hidden) == 1);
+			TEST_CHECK(runner, it->getPropertyInt(Object::Property::SingleChoice) == 1);
+		}
+	}
+}
+
+}
+
+void runObjectTests(TestRunner & runner)
+{
+	runner.run("Object/PropertyTextRoundTrip", testPropertyTextRoundTrip);
+	runner.run("Dungeon/PropertyTextRoundTrip", testDungeonPropertyRoundTrip);
+}
@@ -0,0 +1,10 @@
+#ifndef TESTS_SUITES_HPP
+#define TESTS_SUITES_HPP
+
+class TestRunner;
+
+void runLevelTests(TestRunner & runner);
+void runObjectTests(TestRunner & runner);
+void runUtilityTests(TestRunner & runner);
+
+#endif
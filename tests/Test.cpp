@@ -0,0 +1,48 @@
+#include "Test.hpp"
+
+#include <cstdio>
+
+TestRunner::TestRunner(std::string filter) :
+		filter(filter),
+		currentTestFailed(false),
+		runCount(0),
+		failureCount(0)
+{
+}
+
+void TestRunner::run(const std::string& name, std::function<void(TestRunner&)> test)
+{
+	if (name.compare(0, filter.size(), filter) != 0)
+	{
+		return;
+	}
+
+	currentTest = name;
+	currentTestFailed = false;
+
+	test(*this);
+
+	runCount++;
+
+	if (currentTestFailed)
+	{
+		failureCount++;
+	}
+
+	std::printf("%-48s %s\n", name.c_str(), currentTestFailed ? "FAILED" : "ok");
+}
+
+void TestRunner::check(bool passed, const char* expression, const char* file, int line)
+{
+	if (!passed)
+	{
+		std::fprintf(stderr, "%s:%d: %s: check failed: %s\n", file, line, currentTest.c_str(), expression);
+		currentTestFailed = true;
+	}
+}
+
+bool TestRunner::finish() const
+{
+	std::printf("%zu tests, %zu failed\n", runCount, failureCount);
+	return failureCount == 0;
+}
@@ -0,0 +1,47 @@
+#ifndef TESTS_TEST_HPP
+#define TESTS_TEST_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+/**
+ * Runs named tests and reports failed checks on standard error.
+ *
+ * A test function performs its checks with TEST_CHECK(). A test fails if any of its checks fail, but keeps running, so
+ * that all failed checks of a test are reported.
+ */
+class TestRunner
+{
+public:
+
+	explicit TestRunner(std::string filter);
+
+	/**
+	 * Runs the test with the specified name, unless its name does not start with the filter.
+	 */
+	void run(const std::string & name, std::function<void(TestRunner &)> test);
+
+	/**
+	 * Records the result of a check. Use TEST_CHECK() instead of calling this directly.
+	 */
+	void check(bool passed, const char * expression, const char * file, int line);
+
+	/**
+	 * Prints the number of run and failed tests and returns true if all tests passed.
+	 */
+	bool finish() const;
+
+private:
+
+	std::string filter;
+	std::string currentTest;
+	bool currentTestFailed;
+
+	std::size_t runCount;
+	std::size_t failureCount;
+};
+
+#define TEST_CHECK(runner, expression) (runner).check((expression), #expression, __FILE__, __LINE__)
+
+#endif
@@ -0,0 +1,146 @@
+#include "Suites.hpp"
+#include "Test.hpp"
+
+#include <Shared/Utils/Profiler.hpp>
+#include <Shared/Utils/SeededRandom.hpp>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// Completes the current statistics window, so that the next one only contains the caller's records.
+void startProfilerWindow()
+{
+	for (std::size_t index = Profiler::getStatisticsIndex(); Profiler::getStatisticsIndex() == index;)
+	{
+		Profiler::nextFrame();
+	}
+}
+
+const Profiler::CounterStatistics * findCounter(const Profiler::Statistics & statistics, const std::string & name)
+{
+	for (const Profiler::CounterStatistics & counter : statistics.counters)
+	{
+		if (counter.name == name)
+		{
+			return &counter;
+		}
+	}
+
+	return nullptr;
+}
+
+void testProfilerExitedThreads(TestRunner & runner)
+{
+	Profiler::setEnabled(true);
+	startProfilerWindow();
+
+	std::size_t index = Profiler::getStatisticsIndex();
+
+	// Records of short-lived threads must be kept after their thread buffers have been removed.
+	for (std::size_t frame = 0; frame < Profiler::StatisticsFrameCount; ++frame)
+	{
+		std::vector<std::thread> threads;
+
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			threads.emplace_back([]()
+			{
+				ProfileZone zone("test thread");
+				Profiler::count("test threads", 1);
+			});
+		}
+
+		for (std::thread & thread : threads)
+		{
+			thread.join();
+		}
+
+		Profiler::nextFrame();
+	}
+
+	Profiler::setEnabled(false);
+
+	Profiler::Statistics statistics = Profiler::getStatistics();
+	TEST_CHECK(runner, statistics.index == index + 1);
+
+	std::size_t calls = 0;
+	for (const Profiler::ZoneStatistics & zone : statistics.zones)
+	{
+		if (zone.name == "test thread")
+		{
+			calls = zone.calls;
+		}
+	}
+
+	TEST_CHECK(runner, calls == Profiler::StatisticsFrameCount * 4);
+
+	const Profiler::CounterStatistics * counter = findCounter(statistics, "test threads");
+	TEST_CHECK(runner, counter != nullptr && counter->total == sf::Int64(Profiler::StatisticsFrameCount * 4));
+	TEST_CHECK(runner, counter != nullptr && counter->maxPerFrame == 4);
+}
+
+void testProfilerCountMax(TestRunner & runner)
+{
+	Profiler::setEnabled(true);
+	startProfilerWindow();
+
+	for (std::size_t frame = 0; frame < Profiler::StatisticsFrameCount; ++frame)
+	{
+		// Sampled several times per frame, from several threads: only the largest value counts.
+		Profiler::countMax("test gauge", 3);
+		Profiler::countMax("test gauge", frame % 2 == 0 ? 7 : 5);
+
+		std::thread thread([]()
+		{
+			Profiler::countMax("test gauge", 4);
+		});
+		thread.join();
+
+		Profiler::nextFrame();
+	}
+
+	Profiler::setEnabled(false);
+
+	const std::size_t frames = Profiler::StatisticsFrameCount;
+	const Profiler::CounterStatistics * counter = findCounter(Profiler::getStatistics(), "test gauge");
+	TEST_CHECK(runner, counter != nullptr && counter->maxPerFrame == 7);
+	TEST_CHECK(runner, counter != nullptr && counter->total == sf::Int64((frames + 1) / 2 * 7 + frames / 2 * 5));
+}
+
+
+void testSeededRandomSequence(TestRunner & runner)
+{
+	// The 10000th output of a default-seeded std::mt19937_64 is specified by the standard.
+	SeededRandom engine(5489);
+	for (int i = 1; i < 10000; ++i)
+	{
+		engine.generate64();
+	}
+	TEST_CHECK(runner, engine.generate64() == 9981545732273789042ull);
+
+	// The mapping to ranges must not depend on the standard library either.
+	SeededRandom random(42);
+	TEST_CHECK(runner, random.generateBelow(1000) == 406);
+	TEST_CHECK(runner, random.generateBelow(1000) == 824);
+	TEST_CHECK(runner, random.generateBelow(1000) == 450);
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		float value = random.generateNormFloat();
+		TEST_CHECK(runner, value >= 0.f && value < 1.f);
+		TEST_CHECK(runner, random.generateBelow(3) < 3);
+	}
+}
+
+}
+
+void runUtilityTests(TestRunner & runner)
+{
+	runner.run("Profiler/ExitedThreads", testProfilerExitedThreads);
+	runner.run("Profiler/CountMax", testProfilerCountMax);
+	runner.run("SeededRandom/Sequence", testSeededRandomSequence);
+}
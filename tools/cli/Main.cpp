@@ -0,0 +1,899 @@
+/*
+ * necroedit-cli: headless batch processing of NecroDancer dungeon files.
+ *
+ * Usage: necroedit-cli <command> [options] <dungeon.xml>...
+ *
+ * Files are processed in parallel. Per-file results are printed to standard output in input order, followed by a
+ * throughput summary on standard error.
+ */
+
+#include <SFML/System/Clock.hpp>
+#include <Shared/Editor/BatchEdit.hpp>
+#include <Shared/Editor/Brush.hpp>
+#include <Shared/Editor/DungeonGenerator.hpp>
+#include <Shared/Level/Dungeon.hpp>
+#include <Shared/Level/Level.hpp>
+#include <Shared/Level/Object.hpp>
+#include <Shared/Utils/Event/EventListener.hpp>
+#include <Shared/Utils/MemoryUsage.hpp>
+#include <Shared/Utils/ParallelFor.hpp>
+#include <Shared/Utils/Profiler.hpp>
+#include <Shared/Utils/StrNumCon.hpp>
+#include <Shared/Utils/Utilities.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+enum ExitCode
+{
+	ExitSuccess = 0,
+	ExitFailure = 1,
+	ExitUsage = 2
+};
+
+enum class Command
+{
+	Invalid,
+	Convert,
+	Stats,
+	Validate,
+	Normalize,
+	Generate,
+	Events,
+	Replace
+};
+
+struct Options
+{
+	Options() :
+			command(Command::Invalid),
+			check(false),
+			threads(0),
+			frameEvents(256)
+	{
+	}
+
+	Command command;
+	std::vector<std::string> files;
+	std::string outputPath;
+	bool check;
+	std::size_t threads;
+	std::size_t frameEvents;
+	DungeonGenerator::Config generatorConfig;
+	BatchEdit batchEdit;
+};
+
+/**
+ * Level event traffic observed while replaying a dungeon (see replayEvents()).
+ */
+struct EventReplayResult
+{
+	EventReplayResult() :
+			frames(0),
+			pushed(0),
+			coalesced(0),
+			drained(0),
+			maxDrainedPerFrame(0),
+			highWaterMark(0),
+			latencyFrames(0),
+			totalLatency(0),
+			maxLatency(0)
+	{
+	}
+
+	void add(const EventReplayResult & other)
+	{
+		frames += other.frames;
+		pushed += other.pushed;
+		coalesced += other.coalesced;
+		drained += other.drained;
+		maxDrainedPerFrame = std::max(maxDrainedPerFrame, other.maxDrainedPerFrame);
+		highWaterMark = std::max(highWaterMark, other.highWaterMark);
+		latencyFrames += other.latencyFrames;
+		totalLatency += other.totalLatency;
+		maxLatency = std::max(maxLatency, other.maxLatency);
+	}
+
+	std::size_t frames;
+	std::size_t pushed;
+	std::size_t coalesced;
+	std::size_t drained;
+	std::size_t maxDrainedPerFrame;
+	std::size_t highWaterMark;
+
+	/**
+	 * Number of frames that drained events, and the time in microseconds from each such frame's oldest change to the
+	 * end of its drain, summed over these frames.
+	 */
+	std::size_t latencyFrames;
+	sf::Int64 totalLatency;
+	sf::Int64 maxLatency;
+};
+
+struct FileResult
+{
+	FileResult() :
+			failed(false),
+			bytes(0),
+			levels(0),
+			tiles(0),
+			objects(0),
+			objectCounts(),
+			memory(0),
+			errors(0),
+			warnings(0)
+	{
+	}
+
+	/**
+	 * Adds a diagnostic message line for this file.
+	 */
+	void report(const std::string & file, const std::string & severity, const std::string & text)
+	{
+		output += file + ": " + severity + ": " + text + "\n";
+	}
+
+	bool failed;
+	std::size_t bytes;
+	std::size_t levels;
+	std::size_t tiles;
+	std::size_t objects;
+	std::array<std::size_t, std::size_t(Object::Type::TypeCount)> objectCounts;
+	std::size_t memory;
+	EventReplayResult events;
+	BatchEdit::Result matches;
+	std::size_t errors;
+	std::size_t warnings;
+	std::string output;
+};
+
+void printUsage()
+{
+	std::fprintf(stderr, "Usage: necroedit-cli <command> [options] <dungeon.xml>...\n"
+			"\n"
+			"Commands:\n"
+			"  convert -o <dir>     Load each dungeon and save it to <dir> in the editor's format.\n"
+			"  stats                Print level, tile and object counts and memory usage for each dungeon.\n"
+			"  validate             Check dungeons for errors (exit code 1 if any are found).\n"
+			"  normalize [--check]  Rewrite dungeons in place in the editor's format. With --check, only list\n"
+			"                       files that would change (exit code 1 if any would).\n"
+			"  generate             Write a pseudo-random dungeon to each specified file. The n-th file (counting\n"
+			"                       from 0) uses seed + n * levels, so no two levels share a seed.\n"
+			"  events               Rebuild each level tile by tile and object by object, draining a level event\n"
+			"                       listener after every frame like the editor's renderer, and print event counts,\n"
+			"                       queue high-water marks and change-to-drain latency.\n"
+			"  replace [--check]    Print the number of tiles and objects matching the replace options in each\n"
+			"                       level, then replace or erase them and rewrite the dungeon in place. With\n"
+			"                       --check, only print the matches.\n"
+			"\n"
+			"Options:\n"
+			"  -j <threads>         Number of worker threads (default: number of CPU cores).\n"
+			"  --frame-events <n>   Level changes per simulated frame for the events command (default: 256).\n"
+			"\n"
+			"Generator options:\n"
+			"  --seed <n>           Seed of the first level (default: 1).\n"
+			"  --levels <n>         Number of levels per dungeon (default: 1).\n"
+			"  --size <w>x<h>       Level size in tiles (default: 64x64).\n"
+			"  --tile-density <f>   Fraction of the level area covered by tiles (default: 0.9).\n"
+			"  --wall-ratio <f>     Fraction of tiles that are walls (default: 0.3).\n"
+			"  --torches <f>        Fraction of walls with torches (default: 0.05).\n"
+			"  --objects <f>        Average number of objects per floor tile (default: 0.1).\n"
+			"  --object-mix <list>  Comma-separated relative frequencies of traps, enemies, items, chests, crates\n"
+			"                       and shrines (default: 1,1,1,1,1,1).\n"
+			"\n"
+			"Replace options:\n"
+			"  --tiles <fields>     Match tiles by a comma-separated list of id=<n>, zone=<n>, torch=0|1 and\n"
+			"                       cracked=0|1 (default: all tiles).\n"
+			"  --set-tiles <fields> Overwrite the listed fields of matching tiles.\n"
+			"  --erase-tiles        Erase matching tiles.\n"
+			"  --object-type <type> Match objects of the specified type (default: all objects).\n"
+			"  --where <prop>=<v>   Match objects with the specified property value. Can be repeated.\n"
+			"  --set <prop>=<v>     Assign the specified property value to matching objects. Can be repeated.\n"
+			"  --erase-objects      Erase matching objects.\n");
+}
+
+Command parseCommand(const std::string & name)
+{
+	if (name == "convert")
+		return Command::Convert;
+	if (name == "stats")
+		return Command::Stats;
+	if (name == "validate")
+		return Command::Validate;
+	if (name == "normalize")
+		return Command::Normalize;
+	if (name == "generate")
+		return Command::Generate;
+	if (name == "events")
+		return Command::Events;
+	if (name == "replace")
+		return Command::Replace;
+	return Command::Invalid;
+}
+
+/**
+ * Parses a comma-separated list of tile fields (id=<n>, zone=<n>, torch=0|1, cracked=0|1) into a tile and a mask of
+ * the specified fields. Returns false if a field name is unknown.
+ */
+bool parseTileFields(const std::string & list, Tile & tile, Brush::TileMask & mask)
+{
+	tile = Tile();
+	mask = Brush::TileMask::None;
+
+	for (const std::string & field : splitString(list, ",", true))
+	{
+		std::vector<std::string> pair = splitString(field, "=");
+		int value = pair.size() > 1 ? cStoI(pair[1]) : 0;
+
+		if (pair[0] == "id")
+		{
+			tile.id = value;
+			mask = mask | Brush::TileMask::ID;
+		}
+		else if (pair[0] == "zone")
+		{
+			tile.setZone(value);
+			mask = mask | Brush::TileMask::Zone;
+		}
+		else if (pair[0] == "torch")
+		{
+			tile.hasTorch = value != 0;
+			mask = mask | Brush::TileMask::Torch;
+		}
+		else if (pair[0] == "cracked")
+		{
+			tile.setCracked(value != 0);
+			mask = mask | Brush::TileMask::Cracked;
+		}
+		else
+		{
+			std::fprintf(stderr, "Unknown tile field '%s'\n", pair[0].c_str());
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Splits a <property>=<value> argument. Returns false if the property name is unknown.
+ */
+bool parsePropertyValue(const std::string & arg, Object::Property & property, std::string & value)
+{
+	std::size_t separator = arg.find('=');
+	std::string name = arg.substr(0, separator);
+
+	property = Object::getPropertyByName(name.c_str());
+	value = separator == std::string::npos ? "" : arg.substr(separator + 1);
+
+	if (property == Object::Property::Invalid)
+	{
+		std::fprintf(stderr, "Unknown object property '%s'\n", name.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+bool parseOptions(int argc, char ** argv, Options & options)
+{
+	if (argc < 2)
+	{
+		return false;
+	}
+
+	options.command = parseCommand(argv[1]);
+
+	if (options.command == Command::Invalid)
+	{
+		std::fprintf(stderr, "Unknown command '%s'\n", argv[1]);
+		return false;
+	}
+
+	for (int i = 2; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+
+		if (arg == "-o" && i + 1 < argc)
+		{
+			options.outputPath = argv[++i];
+		}
+		else if (arg == "-j" && i + 1 < argc)
+		{
+			options.threads = cStoUI(argv[++i]);
+		}
+		else if (arg == "--check")
+		{
+			options.check = true;
+		}
+		else if (arg == "--frame-events" && i + 1 < argc)
+		{
+			options.frameEvents = std::max<std::size_t>(cStoUI(argv[++i]), 1);
+		}
+		else if (arg == "--seed" && i + 1 < argc)
+		{
+			options.generatorConfig.seed = cStoUL(argv[++i]);
+		}
+		else if (arg == "--levels" && i + 1 < argc)
+		{
+			options.generatorConfig.levelCount = cStoUI(argv[++i]);
+		}
+		else if (arg == "--size" && i + 1 < argc)
+		{
+			std::vector<std::string> size = splitString(argv[++i], "x");
+			int width = cStoI(size[0]);
+			options.generatorConfig.levelSize = sf::Vector2i(width, size.size() > 1 ? cStoI(size[1]) : width);
+		}
+		else if (arg == "--tile-density" && i + 1 < argc)
+		{
+			options.generatorConfig.tileDensity = cStoF(argv[++i]);
+		}
+		else if (arg == "--wall-ratio" && i + 1 < argc)
+		{
+			options.generatorConfig.wallRatio = cStoF(argv[++i]);
+		}
+		else if (arg == "--torches" && i + 1 < argc)
+		{
+			options.generatorConfig.torchFrequency = cStoF(argv[++i]);
+		}
+		else if (arg == "--objects" && i + 1 < argc)
+		{
+			// Catch a likely mix-up with --object-type, which would make a replace match all objects.
+			if (options.command == Command::Replace)
+			{
+				std::fprintf(stderr, "The replace command filters objects by type with --object-type <type>\n");
+				return false;
+			}
+
+			options.generatorConfig.objectDensity = cStoF(argv[++i]);
+		}
+		else if (arg == "--object-mix" && i + 1 < argc)
+		{
+			std::vector<std::string> weights = splitString(argv[++i], ",");
+			for (std::size_t type = 0; type < options.generatorConfig.objectWeights.size(); ++type)
+			{
+				options.generatorConfig.objectWeights[type] = type < weights.size() ? cStoF(weights[type]) : 0.f;
+			}
+		}
+		else if ((arg == "--tiles" || arg == "--set-tiles") && i + 1 < argc)
+		{
+			Tile tile;
+			Brush::TileMask mask;
+
+			if (!parseTileFields(argv[++i], tile, mask))
+			{
+				return false;
+			}
+
+			if (arg == "--tiles")
+			{
+				options.batchEdit.setTileFilter(tile, mask);
+			}
+			else
+			{
+				options.batchEdit.setTileReplacement(tile, mask);
+				options.batchEdit.setTileAction(BatchEdit::TileAction::Replace);
+			}
+		}
+		else if (arg == "--erase-tiles")
+		{
+			options.batchEdit.setTileAction(BatchEdit::TileAction::Erase);
+		}
+		else if (arg == "--object-type" && i + 1 < argc)
+		{
+			Object::Type type = Object::getTypeByName(argv[++i]);
+
+			if (type == Object::Type::None)
+			{
+				type = Object::getTypeByNamePlural(argv[i]);
+			}
+
+			if (type == Object::Type::None)
+			{
+				std::fprintf(stderr, "Unknown object type '%s'\n", argv[i]);
+				return false;
+			}
+
+			options.batchEdit.setObjectTypeFilter(type);
+		}
+		else if ((arg == "--where" || arg == "--set") && i + 1 < argc)
+		{
+			Object::Property property;
+			std::string value;
+
+			if (!parsePropertyValue(argv[++i], property, value))
+			{
+				return false;
+			}
+
+			if (arg == "--where")
+			{
+				options.batchEdit.addObjectPropertyFilter(property, value);
+			}
+			else
+			{
+				options.batchEdit.addObjectPropertyReplacement(property, value);
+				options.batchEdit.setObjectAction(BatchEdit::ObjectAction::Replace);
+			}
+		}
+		else if (arg == "--erase-objects")
+		{
+			options.batchEdit.setObjectAction(BatchEdit::ObjectAction::Erase);
+		}
+		else if (!arg.empty() && arg[0] == '-')
+		{
+			std::fprintf(stderr, "Unknown option '%s'\n", arg.c_str());
+			return false;
+		}
+		else
+		{
+			options.files.push_back(arg);
+		}
+	}
+
+	if (options.command == Command::Convert && options.outputPath.empty())
+	{
+		std::fprintf(stderr, "The convert command requires an output directory (-o <dir>)\n");
+		return false;
+	}
+
+	if (options.command == Command::Replace && options.batchEdit.getTileAction() == BatchEdit::TileAction::Ignore
+			&& options.batchEdit.getObjectAction() == BatchEdit::ObjectAction::Ignore)
+	{
+		std::fprintf(stderr, "The replace command requires a tile or object action (--set-tiles, --erase-tiles, --set "
+				"or --erase-objects)\n");
+		return false;
+	}
+
+	if (options.files.empty())
+	{
+		std::fprintf(stderr, "No %s files specified\n", options.command == Command::Generate ? "output" : "input");
+		return false;
+	}
+
+	if (options.command == Command::Generate
+			&& (options.generatorConfig.levelSize.x <= 0 || options.generatorConfig.levelSize.y <= 0))
+	{
+		std::fprintf(stderr, "Invalid level size\n");
+		return false;
+	}
+
+	return true;
+}
+
+void gatherStats(const Dungeon & dungeon, FileResult & result)
+{
+	result.levels = dungeon.getLevelCount();
+
+	for (std::size_t i = 0; i < dungeon.getLevelCount(); ++i)
+	{
+		const Level & level = dungeon.getLevel(i);
+
+		for (auto it = level.tilesBegin(); it != level.tilesEnd(); ++it)
+		{
+			result.tiles++;
+		}
+
+		for (auto it = level.objectsBegin(); it != level.objectsEnd(); ++it)
+		{
+			result.objects++;
+
+			if (it->getType() >= Object::Type::Trap && it->getType() < Object::Type::TypeCount)
+			{
+				result.objectCounts[std::size_t(it->getType())]++;
+			}
+		}
+	}
+
+	MemoryUsage usage;
+	dungeon.getMemoryUsage(usage);
+	result.memory = usage.getTotalBytes();
+}
+
+void printStats(const std::string & file, FileResult & result)
+{
+	result.output += file + ": " + cNtoS(result.levels) + " levels, " + cNtoS(result.tiles) + " tiles, "
+			+ cNtoS(result.objects) + " objects (";
+
+	for (std::size_t type = 0; type < result.objectCounts.size(); ++type)
+	{
+		result.output += std::string(type == 0 ? "" : ", ") + cNtoS(result.objectCounts[type]) + " "
+				+ Object::getTypeNamePlural(Object::Type(type));
+	}
+
+	result.output += "), " + getByteSizeString(result.memory) + " in memory\n";
+}
+
+/**
+ * Copies each level of the dungeon into an empty level, frameEvents changes at a time. After each simulated frame, a
+ * listener on the new level is drained, like LevelRenderer::update() does in the editor.
+ */
+void replayEvents(const Dungeon & dungeon, std::size_t frameEvents, FileResult & result)
+{
+	for (std::size_t i = 0; i < dungeon.getLevelCount(); ++i)
+	{
+		const Level & source = dungeon.getLevel(i);
+
+		Level level;
+		EventListener<Level::Event> listener = level.acquireEventListener();
+		std::size_t frameChanges = 0;
+
+		auto endFrame = [&]()
+		{
+			Level::Event event;
+			while (listener.poll(event))
+			{
+			}
+
+			sf::Int64 drainTime = Profiler::getTimestamp();
+			EventStatistics statistics = listener.takeStatistics();
+			EventReplayResult & events = result.events;
+
+			events.frames++;
+			events.pushed += statistics.pushed;
+			events.coalesced += statistics.coalesced;
+			events.drained += statistics.drained;
+			events.maxDrainedPerFrame = std::max(events.maxDrainedPerFrame, statistics.drained);
+			events.highWaterMark = std::max(events.highWaterMark, statistics.highWaterMark);
+
+			if (statistics.oldestPushTime >= 0)
+			{
+				sf::Int64 latency = drainTime - statistics.oldestPushTime;
+				events.latencyFrames++;
+				events.totalLatency += latency;
+				events.maxLatency = std::max(events.maxLatency, latency);
+			}
+
+			frameChanges = 0;
+		};
+
+		for (auto it = source.tilesBegin(); it != source.tilesEnd(); ++it)
+		{
+			level.setTileAt(*it, it.getTile());
+
+			if (++frameChanges >= frameEvents)
+			{
+				endFrame();
+			}
+		}
+
+		for (auto it = source.objectsBegin(); it != source.objectsEnd(); ++it)
+		{
+			level.getObject(level.addObject(it->getType())).assign(*it);
+
+			if (++frameChanges >= frameEvents)
+			{
+				endFrame();
+			}
+		}
+
+		if (frameChanges > 0)
+		{
+			endFrame();
+		}
+	}
+}
+
+void printEventStats(const std::string & file, FileResult & result)
+{
+	const EventReplayResult & events = result.events;
+
+	char latency[64];
+	std::snprintf(latency, sizeof(latency), "%.3f ms avg, %.3f ms max",
+			events.latencyFrames == 0 ? 0.f : events.totalLatency / 1000.f / events.latencyFrames,
+			events.maxLatency / 1000.f);
+
+	result.output += file + ": " + cNtoS(events.frames) + " frames, " + cNtoS(events.pushed) + " events pushed, "
+			+ cNtoS(events.coalesced) + " coalesced, " + cNtoS(events.drained) + " drained (max "
+			+ cNtoS(events.maxDrainedPerFrame) + " per frame), queue high-water mark " + cNtoS(events.highWaterMark)
+			+ ", latency " + latency + "\n";
+}
+
+void printMatches(const std::string & file, const BatchEdit::Result & matches, FileResult & result)
+{
+	for (std::size_t i = 0; i < matches.levelTileCounts.size(); ++i)
+	{
+		result.output += file + ": level " + cNtoS(i + 1) + ": " + cNtoS(matches.levelTileCounts[i]) + " tiles, "
+				+ cNtoS(matches.levelObjectCounts[i]) + " objects\n";
+	}
+
+	result.output += file + ": " + cNtoS(matches.tileCount) + " tiles, " + cNtoS(matches.objectCount)
+			+ " objects matched\n";
+}
+
+void validate(const std::string & file, const Dungeon & dungeon, FileResult & result)
+{
+	if (dungeon.getLevelCount() == 0)
+	{
+		result.report(file, "error", "dungeon has no levels");
+		result.errors++;
+	}
+
+	for (std::size_t i = 0; i < dungeon.getLevelCount(); ++i)
+	{
+		const Level & level = dungeon.getLevel(i);
+		std::string levelPrefix = "level " + cNtoS(i + 1) + ": ";
+
+		if (level.tilesBegin() == level.tilesEnd())
+		{
+			result.report(file, "error", levelPrefix + "level has no tiles");
+			result.errors++;
+			continue;
+		}
+
+		Tile spawnTile = level.getTileAt(level.getPlayerSpawnPoint());
+
+		if (!spawnTile.exists())
+		{
+			result.report(file, "error", levelPrefix + "player spawn point has no tile");
+			result.errors++;
+		}
+		else if (spawnTile.isWall())
+		{
+			result.report(file, "error", levelPrefix + "player spawn point is inside a wall");
+			result.errors++;
+		}
+
+		for (auto it = level.objectsBegin(); it != level.objectsEnd(); ++it)
+		{
+			sf::Vector2i position = it->getPosition() - level.getPlayerSpawnPoint();
+			std::string objectPrefix = levelPrefix + Object::getTypeName(it->getType()) + " at " + cNtoS(position.x)
+					+ "," + cNtoS(position.y) + ": ";
+
+			if (!level.hasTileAt(it->getPosition()))
+			{
+				result.report(file, "warning", objectPrefix + "object is not placed on a tile");
+				result.warnings++;
+			}
+
+			if (it->getType() == Object::Type::Item && it->getPropertyString(Object::Property::Type).empty())
+			{
+				result.report(file, "warning", objectPrefix + "item has no type");
+				result.warnings++;
+			}
+		}
+	}
+}
+
+FileResult generateFile(const Options & options, std::size_t index)
+{
+	FileResult result;
+	const std::string & file = options.files[index];
+
+	DungeonGenerator::Config config = options.generatorConfig;
+	config.seed += index * config.levelCount;
+
+	DungeonGenerator generator;
+	generator.setConfig(config);
+
+	Dungeon dungeon;
+	generator.generate(dungeon);
+
+	if (!dungeon.saveToXML(file))
+	{
+		result.report(file, "error", "failed to write file");
+		result.failed = true;
+		return result;
+	}
+
+	result.bytes = getFileSize(file);
+	gatherStats(dungeon, result);
+	printStats(file, result);
+	return result;
+}
+
+FileResult processFile(const Options & options, const std::string & file)
+{
+	FileResult result;
+
+	if (!fileExists(file))
+	{
+		result.report(file, "error", "file not found");
+		result.failed = true;
+		return result;
+	}
+
+	std::string xmlData = readFile(file);
+	result.bytes = xmlData.size();
+
+	Dungeon dungeon;
+
+	if (!dungeon.loadFromXMLString(xmlData, file))
+	{
+		result.report(file, "error", "failed to parse dungeon");
+		result.failed = true;
+		return result;
+	}
+
+	switch (options.command)
+	{
+	case Command::Convert:
+	{
+		std::string outputFile = options.outputPath + "/" + removeFilePath(file);
+
+		if (!dungeon.saveToXML(outputFile))
+		{
+			result.report(file, "error", "failed to write " + outputFile);
+			result.failed = true;
+			return result;
+		}
+		break;
+	}
+
+	case Command::Stats:
+		gatherStats(dungeon, result);
+		printStats(file, result);
+		break;
+
+	case Command::Validate:
+		validate(file, dungeon, result);
+		result.failed = result.errors != 0;
+		break;
+
+	case Command::Events:
+		replayEvents(dungeon, options.frameEvents, result);
+		printEventStats(file, result);
+		break;
+
+	case Command::Replace:
+	{
+		// Files are already processed in parallel, so process the levels of each file on the file's thread.
+		result.matches = options.batchEdit.find(dungeon, 1);
+		printMatches(file, result.matches, result);
+
+		if (options.check || (result.matches.tileCount == 0 && result.matches.objectCount == 0))
+		{
+			break;
+		}
+
+		BatchEdit::Result changes = options.batchEdit.apply(dungeon, 1);
+
+		if (!dungeon.saveToXML(file))
+		{
+			result.report(file, "error", "failed to write file");
+			result.failed = true;
+			return result;
+		}
+
+		result.output += file + ": " + cNtoS(changes.tileCount) + " tiles, " + cNtoS(changes.objectCount)
+				+ " objects changed\n";
+		break;
+	}
+
+	case Command::Normalize:
+		if (dungeon.saveToXMLString(file) != xmlData)
+		{
+			if (options.check)
+			{
+				result.output += file + ": not normalized\n";
+				result.failed = true;
+			}
+			else if (!dungeon.saveToXML(file))
+			{
+				result.report(file, "error", "failed to write file");
+				result.failed = true;
+				return result;
+			}
+			else
+			{
+				result.output += file + ": normalized\n";
+			}
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	return result;
+}
+
+}
+
+int main(int argc, char ** argv)
+{
+	Options options;
+
+	if (!parseOptions(argc, argv, options))
+	{
+		printUsage();
+		return ExitUsage;
+	}
+
+	if (options.command == Command::Convert && !createDirectoryStructure(options.outputPath))
+	{
+		std::fprintf(stderr, "Failed to create output directory '%s'\n", options.outputPath.c_str());
+		return ExitFailure;
+	}
+
+	std::vector<FileResult> results(options.files.size());
+
+	sf::Clock clock;
+
+	parallelFor(options.files.size(), [&](std::size_t index)
+	{
+		if (options.command == Command::Generate)
+		{
+			results[index] = generateFile(options, index);
+		}
+		else
+		{
+			results[index] = processFile(options, options.files[index]);
+		}
+	}, options.threads);
+
+	float seconds = clock.getElapsedTime().asSeconds();
+
+	// Print results in input order and accumulate totals.
+	FileResult total;
+	std::size_t failedFiles = 0;
+
+	for (const FileResult & result : results)
+	{
+		std::fputs(result.output.c_str(), stdout);
+
+		total.bytes += result.bytes;
+		total.levels += result.levels;
+		total.tiles += result.tiles;
+		total.objects += result.objects;
+		total.memory += result.memory;
+		total.events.add(result.events);
+		total.matches.tileCount += result.matches.tileCount;
+		total.matches.objectCount += result.matches.objectCount;
+		total.errors += result.errors;
+		total.warnings += result.warnings;
+
+		for (std::size_t type = 0; type < total.objectCounts.size(); ++type)
+		{
+			total.objectCounts[type] += result.objectCounts[type];
+		}
+
+		if (result.failed)
+		{
+			failedFiles++;
+		}
+	}
+
+	if ((options.command == Command::Stats || options.command == Command::Generate) && results.size() > 1)
+	{
+		printStats("total", total);
+		std::fputs(total.output.c_str(), stdout);
+	}
+
+	if (options.command == Command::Events && results.size() > 1)
+	{
+		printEventStats("total", total);
+		std::fputs(total.output.c_str(), stdout);
+	}
+
+	if (options.command == Command::Replace && results.size() > 1)
+	{
+		std::printf("total: %zu tiles, %zu objects matched\n", total.matches.tileCount, total.matches.objectCount);
+	}
+
+	if (options.command == Command::Validate)
+	{
+		std::printf("%zu errors, %zu warnings\n", total.errors, total.warnings);
+	}
+
+	std::fflush(stdout);
+
+	// Avoid division by zero for very fast runs.
+	if (seconds <= 0.f)
+	{
+		seconds = 1e-6f;
+	}
+
+	std::fprintf(stderr, "Processed %zu files (%s) in %.3f s: %.1f files/s, %s/s, %zu failed\n", results.size(),
+			getByteSizeString(total.bytes).c_str(), seconds, results.size() / seconds,
+			getByteSizeString(sf::Uint64(total.bytes / seconds)).c_str(), failedFiles);
+
+	return failedFiles == 0 ? ExitSuccess : ExitFailure;
+}